@@ -61,6 +61,11 @@ BL31_SOURCES		+=	lib/pmf/pmf_main.c				\
 				${VENDOR_EL3_SRCS}
 endif
 
+ifeq (${PSCI_STAT_HISTOGRAM}, 1)
+BL31_SOURCES		+=	lib/psci/psci_stat_smc.c			\
+				${VENDOR_EL3_SRCS}
+endif
+
 include lib/debugfs/debugfs.mk
 ifeq (${USE_DEBUGFS},1)
 BL31_SOURCES		+=	${DEBUGFS_SRCS}					\
@@ -6,6 +6,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include <arch.h>
@@ -15,6 +16,7 @@
 #include <common/build_message.h>
 #include <common/debug.h>
 #include <drivers/auth/auth_mod.h>
+#include <drivers/auth/crypto_mod.h>
 #include <drivers/io/io_storage.h>
 #include <lib/utils.h>
 #include <lib/xlat_tables/xlat_tables_defs.h>
@@ -60,6 +62,81 @@ uintptr_t page_align(uintptr_t value, unsigned dir)
 	return value;
 }
 
+#if IMAGE_HASH_ON_LOAD
+#ifndef MBOOT_EL_CRYPTO_MD_ID
+#error "IMAGE_HASH_ON_LOAD requires the Event Log Measured Boot backend"
+#endif
+
+#ifdef PLAT_IMAGE_HASH_CHUNK_SIZE
+#define IMAGE_HASH_CHUNK_SIZE	PLAT_IMAGE_HASH_CHUNK_SIZE
+#else
+#define IMAGE_HASH_CHUNK_SIZE	U(0x4000)
+#endif
+
+/*******************************************************************************
+ * Read an image in chunks of IMAGE_HASH_CHUNK_SIZE bytes and hash each chunk
+ * right after it has been read, while it is still in the data cache. The
+ * platform may hash a chunk asynchronously while the next one is being read.
+ * The digest is kept by the crypto module so that authenticating and measuring
+ * the image do not need to read it again. If the crypto library cannot hash
+ * incrementally, the image is read in one go as usual.
+ ******************************************************************************/
+static int read_and_hash_image(uintptr_t image_handle, uintptr_t image_base,
+			       size_t image_size, size_t *bytes_read)
+{
+	size_t offset = 0U;
+	size_t chunk;
+	size_t chunk_read;
+	bool hashing;
+	int io_result = 0;
+
+	hashing = crypto_mod_image_hash_start(MBOOT_EL_CRYPTO_MD_ID,
+					      (void *)image_base) == 0;
+	if (!hashing) {
+		return io_read(image_handle, image_base, image_size,
+			       bytes_read);
+	}
+
+	while (offset < image_size) {
+		chunk = image_size - offset;
+		if (chunk > IMAGE_HASH_CHUNK_SIZE) {
+			chunk = IMAGE_HASH_CHUNK_SIZE;
+		}
+
+		io_result = io_read(image_handle, image_base + offset, chunk,
+				    &chunk_read);
+		if ((io_result != 0) || (chunk_read < chunk)) {
+			offset += chunk_read;
+			break;
+		}
+
+		if (hashing && (plat_image_hash_update(
+				(void *)(image_base + offset),
+				(unsigned int)chunk) != 0)) {
+			/* Keep loading, the image will be hashed later */
+			hashing = false;
+		}
+
+		offset += chunk;
+	}
+
+	*bytes_read = offset;
+
+	/* Let the hashing of the last chunks complete */
+	if (plat_image_hash_wait() != 0) {
+		hashing = false;
+	}
+
+	if (hashing && (offset == image_size)) {
+		(void)crypto_mod_image_hash_finish();
+	} else {
+		crypto_mod_image_hash_discard();
+	}
+
+	return io_result;
+}
+#endif /* IMAGE_HASH_ON_LOAD */
+
 /*******************************************************************************
  * Internal function to load an image at a specific address given
  * an image ID and extents of free memory.
@@ -124,7 +201,12 @@ static int load_image(unsigned int image_id, image_info_t *image_data)
 
 	/* We have enough space so load the image now */
 	/* TODO: Consider whether to try to recover/retry a partially successful read */
+#if IMAGE_HASH_ON_LOAD
+	io_result = read_and_hash_image(image_handle, image_base, image_size,
+					&bytes_read);
+#else
 	io_result = io_read(image_handle, image_base, image_size, &bytes_read);
+#endif
 	if ((io_result != 0) || (bytes_read < image_size)) {
 		WARN("Failed to load image id=%u (%i)\n", image_id, io_result);
 		goto exit;
@@ -170,12 +252,18 @@ static int load_auth_image_recursive(unsigned int image_id,
 		return rc;
 	}
 
-	/* Authenticate it */
-	rc = auth_mod_verify_img(image_id,
-				 (void *)image_data->image_base,
-				 image_data->image_size);
+	/* Authenticate it, unless the platform checks it before using it */
+	rc = plat_defer_image_auth(image_id, image_data);
+	if (rc == -ENOTSUP) {
+		rc = auth_mod_verify_img(image_id,
+					 (void *)image_data->image_base,
+					 image_data->image_size);
+	}
 	if (rc != 0) {
 		/* Authentication error, zero memory and flush it right away. */
+#if IMAGE_HASH_ON_LOAD
+		crypto_mod_image_hash_discard();
+#endif
 		zero_normalmem((void *)image_data->image_base,
 			       image_data->image_size);
 		flush_dcache_range(image_data->image_base,
@@ -230,6 +318,10 @@ int load_auth_image(unsigned int image_id, image_info_t *image_data)
 		 * it (if MEASURED_BOOT flag is enabled).
 		 */
 		err = plat_mboot_measure_image(image_id, image_data);
+#if IMAGE_HASH_ON_LOAD
+		/* The image may be modified from now on, forget its digest */
+		crypto_mod_image_hash_discard();
+#endif
 		if (err != 0) {
 			return err;
 		}
@@ -6,6 +6,8 @@
 
 #include <stdarg.h>
 #include <assert.h>
+#include <stdint.h>
+#include <string.h>
 
 #include <arm_acle.h>
 #include <common/debug.h>
@@ -32,6 +34,30 @@ uint32_t tf_crc32(uint32_t crc, const unsigned char *buf, size_t size)
 	const unsigned char *local_buf = buf;
 	size_t local_size = size;
 
+#ifdef __aarch64__
+	uint64_t data;
+
+	/*
+	 * calculate CRC over the unaligned head byte by byte, then over
+	 * aligned double words, which avoids alignment faults
+	 */
+	while ((local_size != 0UL) &&
+	       (((uintptr_t)local_buf & (sizeof(data) - 1UL)) != 0UL)) {
+		calc_crc = __crc32b(calc_crc, *local_buf);
+		local_buf++;
+		local_size--;
+	}
+
+	while (local_size >= sizeof(data)) {
+		(void)memcpy(&data, __builtin_assume_aligned(local_buf,
+							    sizeof(data)),
+			     sizeof(data));
+		calc_crc = __crc32d(calc_crc, data);
+		local_buf += sizeof(data);
+		local_size -= sizeof(data);
+	}
+#endif
+
 	/*
 	 * calculate CRC over byte data
 	 */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -579,3 +579,55 @@ int auth_mod_verify_img(unsigned int img_id,
 
 	return 0;
 }
+
+/*
+ * Return the hash that an image authenticated by hash must match, as it was
+ * extracted from the parent image when the parent was authenticated. This
+ * lets a later boot stage check the image with crypto_mod_verify_hash() when
+ * it is about to use it, instead of having auth_mod_verify_img() check it
+ * right after it has been loaded.
+ *
+ * Only images authenticated by their hash alone can be checked this way.
+ *
+ * Return:
+ *   0 = success, Otherwise = error
+ */
+int auth_mod_get_img_hash(unsigned int img_id, void **hash_ptr,
+			  unsigned int *hash_len)
+{
+	const auth_img_desc_t *img_desc;
+	const auth_method_desc_t *auth_method;
+	const auth_param_type_desc_t *hash_desc = NULL;
+	int i;
+
+	img_desc = FCONF_GET_PROPERTY(tbbr, cot, img_id);
+	if ((img_desc == NULL) || (img_desc->parent == NULL) ||
+	    (img_desc->img_auth_methods == NULL)) {
+		return 1;
+	}
+
+	for (i = 0 ; i < AUTH_METHOD_NUM ; i++) {
+		auth_method = &img_desc->img_auth_methods[i];
+		switch (auth_method->type) {
+		case AUTH_METHOD_NONE:
+			break;
+		case AUTH_METHOD_HASH:
+			hash_desc = auth_method->param.hash.hash;
+			break;
+		default:
+			return 1;
+		}
+	}
+
+	if (hash_desc == NULL) {
+		return 1;
+	}
+
+	/* The hash can only be trusted once the parent has been authenticated */
+	if ((auth_img_flags[img_desc->parent->img_id] &
+	     IMG_FLAG_AUTHENTICATED) == 0U) {
+		return 1;
+	}
+
+	return auth_get_param(hash_desc, img_desc->parent, hash_ptr, hash_len);
+}
@@ -1,10 +1,13 @@
 /*
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
 
 #include <common/debug.h>
 #include <drivers/auth/crypto_mod.h>
@@ -48,7 +51,9 @@ void crypto_mod_init(void)
 	assert(crypto_lib_desc.init != NULL);
 #if CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY || \
 CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC
+#if !CRYPTO_VERIFY_HASH_ONLY
 	assert(crypto_lib_desc.verify_signature != NULL);
+#endif
 	assert(crypto_lib_desc.verify_hash != NULL);
 #endif /* CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY || \
 	  CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC */
@@ -89,6 +94,7 @@ int crypto_mod_verify_signature(void *data_ptr, unsigned int data_len,
 	assert(sig_alg_len != 0);
 	assert(pk_ptr != NULL);
 	assert(pk_len != 0);
+	assert(crypto_lib_desc.verify_signature != NULL);
 
 	return crypto_lib_desc.verify_signature(data_ptr, data_len,
 						sig_ptr, sig_len,
@@ -137,6 +143,13 @@ int crypto_mod_calc_hash(enum crypto_md_algo alg, void *data_ptr,
 	assert(data_len != 0);
 	assert(output != NULL);
 
+#if IMAGE_HASH_ON_LOAD
+	if (crypto_mod_get_image_hash(alg, data_ptr, data_len,
+				      output) == CRYPTO_SUCCESS) {
+		return CRYPTO_SUCCESS;
+	}
+#endif
+
 	return crypto_lib_desc.calc_hash(alg, data_ptr, data_len, output);
 }
 #endif /* CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY || \
@@ -187,3 +200,114 @@ int crypto_mod_auth_decrypt(enum crypto_dec_algo dec_algo, void *data_ptr,
 					    key_len, key_flags, iv, iv_len, tag,
 					    tag_len);
 }
+
+#if IMAGE_HASH_ON_LOAD
+/*
+ * Digest of the last image that was hashed while it was being loaded. It is
+ * only handed out for the same algorithm and the exact same memory range, and
+ * it is discarded by the image loader as soon as the image has been
+ * authenticated and measured, so stale digests cannot be returned for memory
+ * which has been modified since.
+ */
+static struct {
+	enum crypto_md_algo alg;
+	uintptr_t base;
+	size_t len;
+	bool in_progress;
+	bool valid;
+	unsigned char digest[CRYPTO_MD_MAX_SIZE];
+} image_hash;
+
+/*
+ * Start hashing an image which is about to be loaded at 'data_ptr'. Returns
+ * CRYPTO_ERR_HASH if the crypto library cannot hash incrementally.
+ */
+int crypto_mod_image_hash_start(enum crypto_md_algo alg, void *data_ptr)
+{
+	int rc;
+
+	crypto_mod_image_hash_discard();
+
+	if (crypto_lib_desc.calc_hash_start == NULL) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	rc = crypto_lib_desc.calc_hash_start(alg);
+	if (rc != CRYPTO_SUCCESS) {
+		return rc;
+	}
+
+	image_hash.alg = alg;
+	image_hash.base = (uintptr_t)data_ptr;
+	image_hash.in_progress = true;
+
+	return CRYPTO_SUCCESS;
+}
+
+/*
+ * Hash the next chunk of the image. Chunks must be passed in order and must
+ * be contiguous in memory.
+ */
+int crypto_mod_image_hash_update(void *data_ptr, unsigned int data_len)
+{
+	int rc;
+
+	assert(image_hash.in_progress);
+	assert((uintptr_t)data_ptr == (image_hash.base + image_hash.len));
+
+	rc = crypto_lib_desc.calc_hash_update(data_ptr, data_len);
+	if (rc != CRYPTO_SUCCESS) {
+		crypto_mod_image_hash_discard();
+		return rc;
+	}
+
+	image_hash.len += data_len;
+
+	return CRYPTO_SUCCESS;
+}
+
+/* Finalise the digest of the image and make it available for reuse */
+int crypto_mod_image_hash_finish(void)
+{
+	int rc;
+
+	assert(image_hash.in_progress);
+
+	rc = crypto_lib_desc.calc_hash_finish(image_hash.digest);
+	image_hash.in_progress = false;
+	image_hash.valid = (rc == CRYPTO_SUCCESS);
+
+	return rc;
+}
+
+/* Abort a calculation in progress and forget any cached digest */
+void crypto_mod_image_hash_discard(void)
+{
+	if (image_hash.in_progress) {
+		/* Let the library release its context */
+		(void)crypto_lib_desc.calc_hash_finish(image_hash.digest);
+	}
+
+	(void)memset(&image_hash, 0, sizeof(image_hash));
+}
+
+/*
+ * Get the digest of the image loaded at 'data_ptr' if it was calculated with
+ * 'alg' over exactly 'data_len' bytes. Returns CRYPTO_ERR_HASH otherwise, in
+ * which case the caller has to hash the data itself.
+ */
+int crypto_mod_get_image_hash(enum crypto_md_algo alg, void *data_ptr,
+			      unsigned int data_len,
+			      unsigned char output[CRYPTO_MD_MAX_SIZE])
+{
+	if (!image_hash.valid || (image_hash.alg != alg) ||
+	    (image_hash.base != (uintptr_t)data_ptr) ||
+	    (image_hash.len != data_len)) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	(void)memcpy(output, image_hash.digest, CRYPTO_MD_MAX_SIZE);
+
+	return CRYPTO_SUCCESS;
+}
+#endif /* IMAGE_HASH_ON_LOAD */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -25,6 +25,10 @@
 
 #define LIB_NAME		"mbed TLS"
 
+#if CRYPTO_VERIFY_HASH_ONLY && (CRYPTO_SUPPORT != CRYPTO_AUTH_VERIFY_ONLY)
+#error "CRYPTO_VERIFY_HASH_ONLY requires CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY"
+#endif
+
 #if CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY || \
 CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC
 /*
@@ -77,6 +81,8 @@ int mbedtls_x509_get_sig_alg(const mbedtls_x509_buf *sig_oid,
 			     mbedtls_md_type_t *md_alg,
 			     mbedtls_pk_type_t *pk_alg,
 			     void **sig_opts);
+
+#if !CRYPTO_VERIFY_HASH_ONLY
 /*
  * Verify a signature.
  *
@@ -165,6 +171,41 @@ end2:
 	mbedtls_free(sig_opts);
 	return rc;
 }
+#endif /* !CRYPTO_VERIFY_HASH_ONLY */
+
+/*
+ * Calculate the hash of the data for verify_hash(). If the data is an image
+ * which was hashed with the same algorithm while it was being loaded, that
+ * digest is reused instead.
+ */
+static int verify_hash_calc(const mbedtls_md_info_t *md_info, void *data_ptr,
+			    unsigned int data_len, unsigned char *output)
+{
+#if IMAGE_HASH_ON_LOAD
+	enum crypto_md_algo alg;
+
+	switch (mbedtls_md_get_type(md_info)) {
+	case MBEDTLS_MD_SHA256:
+		alg = CRYPTO_MD_SHA256;
+		break;
+	case MBEDTLS_MD_SHA384:
+		alg = CRYPTO_MD_SHA384;
+		break;
+	case MBEDTLS_MD_SHA512:
+		alg = CRYPTO_MD_SHA512;
+		break;
+	default:
+		return mbedtls_md(md_info, data_ptr, data_len, output);
+	}
+
+	if (crypto_mod_get_image_hash(alg, data_ptr, data_len,
+				      output) == CRYPTO_SUCCESS) {
+		return 0;
+	}
+#endif /* IMAGE_HASH_ON_LOAD */
+
+	return mbedtls_md(md_info, data_ptr, data_len, output);
+}
 
 /*
  * Match a hash
@@ -228,7 +269,7 @@ static int verify_hash(void *data_ptr, unsigned int data_len,
 
 	/* Calculate the hash of the data */
 	p = (unsigned char *)data_ptr;
-	rc = mbedtls_md(md_info, p, data_len, data_hash);
+	rc = verify_hash_calc(md_info, p, data_len, data_hash);
 	if (rc != 0) {
 		return CRYPTO_ERR_HASH;
 	}
@@ -294,6 +335,52 @@ static int calc_hash(enum crypto_md_algo md_algo, void *data_ptr,
 
 	return CRYPTO_SUCCESS;
 }
+
+#if IMAGE_HASH_ON_LOAD
+/* Context of the incremental hash calculation in progress */
+static mbedtls_md_context_t calc_hash_ctx;
+
+static int calc_hash_start(enum crypto_md_algo md_algo)
+{
+	const mbedtls_md_info_t *md_info;
+
+	md_info = mbedtls_md_info_from_type(md_type(md_algo));
+	if (md_info == NULL) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	mbedtls_md_init(&calc_hash_ctx);
+	if ((mbedtls_md_setup(&calc_hash_ctx, md_info, 0) != 0) ||
+	    (mbedtls_md_starts(&calc_hash_ctx) != 0)) {
+		mbedtls_md_free(&calc_hash_ctx);
+		return CRYPTO_ERR_HASH;
+	}
+
+	return CRYPTO_SUCCESS;
+}
+
+static int calc_hash_update(void *data_ptr, unsigned int data_len)
+{
+	if (mbedtls_md_update(&calc_hash_ctx, data_ptr, data_len) != 0) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	return CRYPTO_SUCCESS;
+}
+
+static int calc_hash_finish(unsigned char output[CRYPTO_MD_MAX_SIZE])
+{
+	int rc;
+
+	rc = mbedtls_md_finish(&calc_hash_ctx, output);
+	mbedtls_md_free(&calc_hash_ctx);
+	if (rc != 0) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	return CRYPTO_SUCCESS;
+}
+#endif /* IMAGE_HASH_ON_LOAD */
 #endif /* CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY || \
 	  CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC */
 
@@ -415,7 +502,11 @@ static int auth_decrypt(enum crypto_dec_algo dec_algo, void *data_ptr,
  * Register crypto library descriptor
  */
 #if CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC
-#if TF_MBEDTLS_USE_AES_GCM
+#if IMAGE_HASH_ON_LOAD
+REGISTER_CRYPTO_LIB_HASH_STREAM(LIB_NAME, init, verify_signature, verify_hash,
+				calc_hash, NULL, NULL, calc_hash_start,
+				calc_hash_update, calc_hash_finish);
+#elif TF_MBEDTLS_USE_AES_GCM
 REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, calc_hash,
 		    auth_decrypt, NULL);
 #else
@@ -423,7 +514,9 @@ REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, calc_hash,
 		    NULL, NULL);
 #endif
 #elif CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY
-#if TF_MBEDTLS_USE_AES_GCM
+#if CRYPTO_VERIFY_HASH_ONLY
+REGISTER_CRYPTO_LIB(LIB_NAME, init, NULL, verify_hash, NULL, NULL, NULL);
+#elif TF_MBEDTLS_USE_AES_GCM
 REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, NULL,
 		    auth_decrypt, NULL);
 #else
@@ -431,5 +524,11 @@ REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, NULL,
 		    NULL, NULL);
 #endif
 #elif CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY
+#if IMAGE_HASH_ON_LOAD
+REGISTER_CRYPTO_LIB_HASH_STREAM(LIB_NAME, init, NULL, NULL, calc_hash, NULL,
+				NULL, calc_hash_start, calc_hash_update,
+				calc_hash_finish);
+#else
 REGISTER_CRYPTO_LIB(LIB_NAME, init, NULL, NULL, calc_hash, NULL, NULL);
+#endif
 #endif /* CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC */
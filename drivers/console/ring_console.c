@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <drivers/console.h>
+#include <drivers/ring_console.h>
+
+/*
+ * Logs are written to memory, so printing never waits for a UART. Whatever
+ * the UART can take without waiting is written to it each time a character is
+ * logged, and the rest when the console is flushed, i.e. before the next image
+ * is entered and on panic.
+ */
+
+static inline console_ring_t *to_ring(console_t *console)
+{
+	return (console_ring_t *)console;
+}
+
+void console_ring_drain(console_ring_t *ring)
+{
+	if (ring->uart == NULL) {
+		return;
+	}
+
+	/* What has been overwritten in the meantime is lost to the UART */
+	if ((ring->head - ring->tail) > ring->size) {
+		ring->tail = ring->head - ring->size;
+	}
+
+	while (ring->tail != ring->head) {
+		if (ring->uart_try_putc(ring->log[ring->tail & (ring->size - 1U)],
+					ring->uart) < 0) {
+			break;
+		}
+		ring->tail++;
+	}
+}
+
+static int console_ring_putc(int c, console_t *console)
+{
+	console_ring_t *ring = to_ring(console);
+
+	ring->log[ring->head & (ring->size - 1U)] = (uint8_t)c;
+	ring->head++;
+	ring->hdr->head = ring->head;
+
+	console_ring_drain(ring);
+
+	return c;
+}
+
+static void console_ring_flush(console_t *console)
+{
+	console_ring_t *ring = to_ring(console);
+
+	if (ring->uart == NULL) {
+		return;
+	}
+
+	while (ring->tail != ring->head) {
+		console_ring_drain(ring);
+	}
+
+	if (ring->uart->flush != NULL) {
+		ring->uart->flush(ring->uart);
+	}
+}
+
+void console_ring_set_uart(console_ring_t *ring, console_t *uart,
+			   int (*try_putc)(int c, console_t *uart))
+{
+	assert((uart == NULL) || (try_putc != NULL));
+
+	console_ring_flush(&ring->console);
+
+	ring->uart = uart;
+	ring->uart_try_putc = try_putc;
+}
+
+static const console_t ring_console = {
+	.flags = CONSOLE_FLAG_BOOT | CONSOLE_FLAG_RUNTIME | CONSOLE_FLAG_CRASH |
+		 CONSOLE_FLAG_TRANSLATE_CRLF,
+	.putc = console_ring_putc,
+	.flush = console_ring_flush,
+};
+
+int console_ring_register(uintptr_t base, size_t size, console_ring_t *ring)
+{
+	struct ring_console_hdr *hdr = (struct ring_console_hdr *)base;
+	uint32_t log_size = 1U;
+
+	assert(size > sizeof(*hdr));
+
+	/* Keep the log size a power of two so that 'head' can wrap around */
+	while ((log_size << 1) <= (size - sizeof(*hdr))) {
+		log_size <<= 1;
+	}
+
+	(void)memcpy(&ring->console, &ring_console, sizeof(console_t));
+	ring->console.base = base;
+	ring->hdr = hdr;
+	ring->log = (uint8_t *)(hdr + 1);
+	ring->size = log_size;
+	ring->uart = NULL;
+	ring->uart_try_putc = NULL;
+
+	/* Carry on from the log left by the previous boot stage */
+	if ((hdr->magic != RING_CONSOLE_MAGIC) || (hdr->size != log_size)) {
+		hdr->magic = RING_CONSOLE_MAGIC;
+		hdr->size = log_size;
+		hdr->head = 0U;
+		hdr->reserved = 0U;
+	}
+
+	ring->head = hdr->head;
+	ring->tail = ring->head;
+
+	return console_register(&ring->console);
+}
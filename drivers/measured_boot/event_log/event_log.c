@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -30,6 +30,28 @@ static uint8_t *log_ptr;
 /* Pointer to the first byte past end of the Event Log buffer */
 static uintptr_t log_end;
 
+/*
+ * TCG_PCR_EVENT2 fields which do not depend on the measurement, precomputed
+ * from the metadata of an image
+ */
+typedef struct {
+	/* PCRIndex, EventType, Digests.Count and Digests[0].AlgorithmId */
+	uint8_t header[sizeof(event2_header_t) + sizeof(tpmt_ha)];
+	/* EventSize */
+	uint32_t event_size;
+	/* Event[] */
+	const char *event;
+} event_log_template_t;
+
+/* Metadata table indexed by event_log_index_metadata() */
+static const event_log_metadata_t *indexed_metadata;
+
+/* Templates of the indexed metadata entries */
+static event_log_template_t templates[EVLOG_MAX_INDEXED];
+
+/* Index + 1 of the template for each data ID, 0 if it is not indexed */
+static uint8_t template_index[MAX_NUMBER_IDS];
+
 /* TCG_EfiSpecIdEvent */
 static const id_event_headers_t id_event_header = {
 	.header = {
@@ -75,6 +97,67 @@ static const event2_header_t locality_event_header = {
 	}
 };
 
+static void event_log_make_template(event_log_template_t *tmpl,
+				   uint32_t event_type,
+				   const event_log_metadata_t *metadata_ptr)
+{
+	event2_header_t *header = (event2_header_t *)tmpl->header;
+
+	/* TCG_PCR_EVENT2.PCRIndex */
+	header->pcr_index = metadata_ptr->pcr;
+
+	/* TCG_PCR_EVENT2.EventType */
+	header->event_type = event_type;
+
+	/* TCG_PCR_EVENT2.Digests.Count */
+	header->digests.count = HASH_ALG_COUNT;
+
+	/* TCG_PCR_EVENT2.Digests[].AlgorithmId */
+	((tpmt_ha *)(tmpl->header + sizeof(event2_header_t)))->algorithm_id =
+		TPM_ALG_ID;
+
+	/* TCG_PCR_EVENT2.EventSize and TCG_PCR_EVENT2.Event */
+	tmpl->event = metadata_ptr->name;
+	tmpl->event_size = 0U;
+	if (metadata_ptr->name != NULL) {
+		tmpl->event_size = (uint32_t)strlen(metadata_ptr->name) + 1U;
+	}
+}
+
+/*
+ * Write a TCG_PCR_EVENT2 event from its template and digest, as one copy of
+ * each of them.
+ */
+static void event_log_write_event(const uint8_t *hash,
+				  const event_log_template_t *tmpl)
+{
+	uint8_t *ptr = log_ptr;
+
+	/* event_log_buf_init() must have been called prior to this. */
+	assert(log_ptr != NULL);
+
+	/* Check for space in Event Log buffer */
+	assert(((uintptr_t)ptr + (uint32_t)EVENT2_HDR_SIZE +
+		tmpl->event_size) < log_end);
+
+	(void)memcpy(ptr, tmpl->header, sizeof(tmpl->header));
+	ptr += sizeof(tmpl->header);
+
+	/* TCG_PCR_EVENT2.Digests[].Digest[] */
+	(void)memcpy(ptr, hash, TCG_DIGEST_SIZE);
+	ptr += TCG_DIGEST_SIZE;
+
+	(void)memcpy(ptr, &tmpl->event_size, sizeof(tmpl->event_size));
+	ptr += sizeof(tmpl->event_size);
+
+	if (tmpl->event_size != 0U) {
+		(void)memcpy(ptr, tmpl->event, tmpl->event_size);
+	}
+
+	/* End of event data */
+	log_ptr = ptr + tmpl->event_size;
+}
+
 /*
  * Record a measurement as a TCG_PCR_EVENT2 event
  *
@@ -88,63 +171,62 @@ static const event2_header_t locality_event_header = {
 void event_log_record(const uint8_t *hash, uint32_t event_type,
 		      const event_log_metadata_t *metadata_ptr)
 {
-	void *ptr = log_ptr;
-	uint32_t name_len = 0U;
+	event_log_template_t tmpl;
 
 	assert(hash != NULL);
 	assert(metadata_ptr != NULL);
-	/* event_log_buf_init() must have been called prior to this. */
-	assert(log_ptr != NULL);
-
-	if (metadata_ptr->name != NULL) {
-		name_len = (uint32_t)strlen(metadata_ptr->name) + 1U;
-	}
-
-	/* Check for space in Event Log buffer */
-	assert(((uintptr_t)ptr + (uint32_t)EVENT2_HDR_SIZE + name_len) <
-	       log_end);
 
 	/*
 	 * As per TCG specifications, firmware components that are measured
 	 * into PCR[0] must be logged in the event log using the event type
 	 * EV_POST_CODE.
 	 */
-	/* TCG_PCR_EVENT2.PCRIndex */
-	((event2_header_t *)ptr)->pcr_index = metadata_ptr->pcr;
-
-	/* TCG_PCR_EVENT2.EventType */
-	((event2_header_t *)ptr)->event_type = event_type;
-
-	/* TCG_PCR_EVENT2.Digests.Count */
-	ptr = (uint8_t *)ptr + offsetof(event2_header_t, digests);
-	((tpml_digest_values *)ptr)->count = HASH_ALG_COUNT;
-
-	/* TCG_PCR_EVENT2.Digests[] */
-	ptr = (uint8_t *)((uintptr_t)ptr +
-			offsetof(tpml_digest_values, digests));
-
-	/* TCG_PCR_EVENT2.Digests[].AlgorithmId */
-	((tpmt_ha *)ptr)->algorithm_id = TPM_ALG_ID;
-
-	/* TCG_PCR_EVENT2.Digests[].Digest[] */
-	ptr = (uint8_t *)((uintptr_t)ptr + offsetof(tpmt_ha, digest));
+	event_log_make_template(&tmpl, event_type, metadata_ptr);
+	event_log_write_event(hash, &tmpl);
+}
 
-	/* Copy digest */
-	(void)memcpy(ptr, (const void *)hash, TCG_DIGEST_SIZE);
+/*
+ * Precompute the events of the entries of a metadata table, so that
+ * event_log_measure_and_record() can look them up by data ID instead of
+ * scanning the table, and write them with fewer copies. Only one table can be
+ * indexed, and only its entries with a data ID below MAX_NUMBER_IDS; the
+ * others are still looked up by scanning the table.
+ *
+ * @param[in] metadata_ptr	Event Log metadata table, which must remain
+ *				valid for as long as it is used
+ * @return:
+ *	0 = success
+ *	-ENOSPC = not all the entries could be indexed
+ */
+int event_log_index_metadata(const event_log_metadata_t *metadata_ptr)
+{
+	unsigned int num = 0U;
+	int rc = 0;
 
-	/* TCG_PCR_EVENT2.EventSize */
-	ptr = (uint8_t *)((uintptr_t)ptr + TCG_DIGEST_SIZE);
-	((event2_data_t *)ptr)->event_size = name_len;
+	assert(metadata_ptr != NULL);
 
-	/* Copy event data to TCG_PCR_EVENT2.Event */
-	if (metadata_ptr->name != NULL) {
-		(void)memcpy((void *)(((event2_data_t *)ptr)->event),
-				(const void *)metadata_ptr->name, name_len);
+	indexed_metadata = metadata_ptr;
+	(void)memset(template_index, 0, sizeof(template_index));
+
+	for (; metadata_ptr->id != EVLOG_INVALID_ID; metadata_ptr++) {
+		if ((metadata_ptr->id >= MAX_NUMBER_IDS) ||
+		    (num == EVLOG_MAX_INDEXED)) {
+			rc = -ENOSPC;
+			continue;
+		}
+
+		/* Keep the first entry for an ID, as the scan would */
+		if (template_index[metadata_ptr->id] != 0U) {
+			continue;
+		}
+
+		event_log_make_template(&templates[num], EV_POST_CODE,
+					metadata_ptr);
+		template_index[metadata_ptr->id] = (uint8_t)(num + 1U);
+		num++;
 	}
 
-	/* End of event data */
-	log_ptr = (uint8_t *)((uintptr_t)ptr +
-			offsetof(event2_data_t, event) + name_len);
+	return rc;
 }
 
 void event_log_buf_init(uint8_t *event_log_start, uint8_t *event_log_finish)
@@ -277,16 +359,25 @@ int event_log_measure_and_record(uintptr_t data_base, uint32_t data_size,
 				 const event_log_metadata_t *metadata_ptr)
 {
 	unsigned char hash_data[CRYPTO_MD_MAX_SIZE];
+	event_log_template_t tmpl;
+	const event_log_template_t *tmpl_ptr = &tmpl;
 	int rc;
 
 	assert(metadata_ptr != NULL);
 
 	/* Get the metadata associated with this image. */
-	while ((metadata_ptr->id != EVLOG_INVALID_ID) &&
-		(metadata_ptr->id != data_id)) {
-		metadata_ptr++;
+	if ((metadata_ptr == indexed_metadata) &&
+	    (data_id < MAX_NUMBER_IDS) && (template_index[data_id] != 0U)) {
+		tmpl_ptr = &templates[template_index[data_id] - 1U];
+	} else {
+		while ((metadata_ptr->id != EVLOG_INVALID_ID) &&
+			(metadata_ptr->id != data_id)) {
+			metadata_ptr++;
+		}
+		assert(metadata_ptr->id != EVLOG_INVALID_ID);
+
+		event_log_make_template(&tmpl, EV_POST_CODE, metadata_ptr);
 	}
-	assert(metadata_ptr->id != EVLOG_INVALID_ID);
 
 	/* Measure the payload with algorithm selected by EventLog driver */
 	rc = event_log_measure(data_base, data_size, hash_data);
@@ -294,7 +385,7 @@ int event_log_measure_and_record(uintptr_t data_base, uint32_t data_size,
 		return rc;
 	}
 
-	event_log_record(hash_data, EV_POST_CODE, metadata_ptr);
+	event_log_write_event(hash_data, tmpl_ptr);
 
 	return 0;
 }
@@ -19,12 +19,15 @@ endif
 ifeq (${MBOOT_EL_HASH_ALG}, sha512)
     TPM_ALG_ID			:=	TPM_ALG_SHA512
     TCG_DIGEST_SIZE		:=	64U
+    MBOOT_EL_CRYPTO_MD_ID	:=	CRYPTO_MD_SHA512
 else ifeq (${MBOOT_EL_HASH_ALG}, sha384)
     TPM_ALG_ID			:=	TPM_ALG_SHA384
     TCG_DIGEST_SIZE		:=	48U
+    MBOOT_EL_CRYPTO_MD_ID	:=	CRYPTO_MD_SHA384
 else
     TPM_ALG_ID			:=	TPM_ALG_SHA256
     TCG_DIGEST_SIZE		:=	32U
+    MBOOT_EL_CRYPTO_MD_ID	:=	CRYPTO_MD_SHA256
 endif #MBOOT_EL_HASH_ALG
 
 # Set definitions for Measured Boot driver.
@@ -33,6 +36,7 @@ $(eval $(call add_defines,\
         TPM_ALG_ID \
         TCG_DIGEST_SIZE \
         EVENT_LOG_LEVEL \
+        MBOOT_EL_CRYPTO_MD_ID \
 )))
 
 EVENT_LOG_SRC_DIR	:= drivers/measured_boot/event_log/
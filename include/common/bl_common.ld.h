@@ -39,6 +39,16 @@
 	KEEP(*(.rt_svc_descs))				\
 	__RT_SVC_DESCS_END__ = .;
 
+#if SMC_LEAF_FASTPATH
+#define RT_SVC_LEAF_DESCS				\
+	. = ALIGN(STRUCT_ALIGN);			\
+	__RT_SVC_LEAF_DESCS_START__ = .;		\
+	KEEP(*(.rt_svc_leaf_descs))			\
+	__RT_SVC_LEAF_DESCS_END__ = .;
+#else
+#define RT_SVC_LEAF_DESCS
+#endif
+
 #if SPMC_AT_EL3
 #define EL3_LP_DESCS					\
 	. = ALIGN(STRUCT_ALIGN);			\
@@ -103,6 +113,7 @@
 
 #define RODATA_COMMON					\
 	RT_SVC_DESCS					\
+	RT_SVC_LEAF_DESCS				\
 	FCONF_POPULATOR					\
 	PMF_SVC_DESCS					\
 	PARSER_LIB_DESCS				\
@@ -39,6 +39,21 @@
  */
 #define MAX_RT_SVCS		U(128)
 
+#if SMC_LEAF_FASTPATH
+/*
+ * Constants to allow the assembler access a leaf runtime service
+ * descriptor
+ */
+#define RT_SVC_LEAF_DESC_FID	U(0)
+#define RT_SVC_LEAF_DESC_FLAGS	U(4)
+#define RT_SVC_LEAF_DESC_X1	U(8)
+#define RT_SVC_LEAF_DESC_HANDLE	U(16)
+#define SIZEOF_RT_SVC_LEAF_DESC	U(24)
+
+/* Leaf descriptor flags */
+#define RT_SVC_LEAF_MATCH_X1	U(1)
+#endif /* SMC_LEAF_FASTPATH */
+
 #ifndef __ASSEMBLER__
 
 /* Prototype for runtime service initializing function */
@@ -97,6 +112,51 @@ CASSERT(RT_SVC_DESC_INIT == __builtin_offsetof(rt_svc_desc_t, init),
 CASSERT(RT_SVC_DESC_HANDLE == __builtin_offsetof(rt_svc_desc_t, handle),
 	assert_rt_svc_desc_handle_offset_mismatch);
 
+#if SMC_LEAF_FASTPATH
+/*
+ * Prototype for a leaf SMC handler. x1-x4 are as passed by the caller and the
+ * return value is handed back in x0. All other registers seen by the caller are
+ * preserved. A leaf handler runs on the EL3 runtime stack but without the lower
+ * EL context having been saved, so it must not access the context (there is no
+ * 'handle'), switch worlds, or return more than one value.
+ */
+typedef u_register_t (*rt_svc_leaf_handle_t)(u_register_t x1,
+					     u_register_t x2,
+					     u_register_t x3,
+					     u_register_t x4);
+typedef struct rt_svc_leaf_desc {
+	uint32_t smc_fid;
+	uint32_t flags;
+	u_register_t x1;
+	rt_svc_leaf_handle_t handle;
+} rt_svc_leaf_desc_t;
+
+/*
+ * Convenience macro to declare a leaf SMC. '_fid' is the fast SMC function ID
+ * to match. If '_flags' contains RT_SVC_LEAF_MATCH_X1 the descriptor only
+ * matches when x1 also equals '_x1', which allows a single sub-command of a
+ * multiplexed SiP call to be made a leaf. Any SMC without a matching leaf
+ * descriptor goes through the regular runtime service path.
+ */
+#define DECLARE_RT_SVC_LEAF(_name, _fid, _flags, _x1, _handle)		\
+	static const rt_svc_leaf_desc_t __svc_leaf_desc_ ## _name	\
+		__section(".rt_svc_leaf_descs") __used = {		\
+			.smc_fid = (_fid),				\
+			.flags = (_flags),				\
+			.x1 = (_x1),					\
+			.handle = (_handle)				\
+		}
+
+CASSERT((sizeof(rt_svc_leaf_desc_t) == SIZEOF_RT_SVC_LEAF_DESC),
+	assert_sizeof_rt_svc_leaf_desc_mismatch);
+CASSERT(RT_SVC_LEAF_DESC_FLAGS == __builtin_offsetof(rt_svc_leaf_desc_t, flags),
+	assert_rt_svc_leaf_desc_flags_offset_mismatch);
+CASSERT(RT_SVC_LEAF_DESC_X1 == __builtin_offsetof(rt_svc_leaf_desc_t, x1),
+	assert_rt_svc_leaf_desc_x1_offset_mismatch);
+CASSERT(RT_SVC_LEAF_DESC_HANDLE == __builtin_offsetof(rt_svc_leaf_desc_t, handle),
+	assert_rt_svc_leaf_desc_handle_offset_mismatch);
+#endif /* SMC_LEAF_FASTPATH */
+
 
 /*
  * This function combines the call type and the owning entity number
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -11,6 +11,15 @@
 #define	CRYPTO_HASH_CALC_ONLY			2
 #define	CRYPTO_AUTH_VERIFY_AND_HASH_CALC	3
 
+/*
+ * An image which only matches data against digests it already trusts can set
+ * CRYPTO_VERIFY_HASH_ONLY with CRYPTO_AUTH_VERIFY_ONLY, so that the signature
+ * verification code of the crypto library is not linked in.
+ */
+#ifndef CRYPTO_VERIFY_HASH_ONLY
+#define	CRYPTO_VERIFY_HASH_ONLY			0
+#endif
+
 /* Return values */
 enum crypto_ret_value {
 	CRYPTO_SUCCESS = 0,
@@ -79,6 +88,15 @@ typedef struct crypto_lib_desc_s {
 			    unsigned int key_flags, const void *iv,
 			    unsigned int iv_len, const void *tag,
 			    unsigned int tag_len);
+
+	/*
+	 * Incremental hash calculation (optional). Only one calculation is in
+	 * progress at any time. Return one of the 'enum crypto_ret_value'
+	 * options.
+	 */
+	int (*calc_hash_start)(enum crypto_md_algo md_alg);
+	int (*calc_hash_update)(void *data_ptr, unsigned int data_len);
+	int (*calc_hash_finish)(unsigned char output[CRYPTO_MD_MAX_SIZE]);
 } crypto_lib_desc_t;
 
 /* Public functions */
@@ -118,6 +136,16 @@ int crypto_mod_calc_hash(enum crypto_md_algo alg, void *data_ptr,
 int crypto_mod_convert_pk(void *full_pk_ptr, unsigned int full_pk_len,
 			  void **hashed_pk_ptr, unsigned int *hashed_pk_len);
 
+#if IMAGE_HASH_ON_LOAD
+int crypto_mod_image_hash_start(enum crypto_md_algo alg, void *data_ptr);
+int crypto_mod_image_hash_update(void *data_ptr, unsigned int data_len);
+int crypto_mod_image_hash_finish(void);
+void crypto_mod_image_hash_discard(void);
+int crypto_mod_get_image_hash(enum crypto_md_algo alg, void *data_ptr,
+			      unsigned int data_len,
+			      unsigned char output[CRYPTO_MD_MAX_SIZE]);
+#endif /* IMAGE_HASH_ON_LOAD */
+
 /* Macro to register a cryptographic library */
 #define REGISTER_CRYPTO_LIB(_name, _init, _verify_signature, _verify_hash, \
 			    _calc_hash, _auth_decrypt, _convert_pk) \
@@ -131,6 +159,24 @@ int crypto_mod_convert_pk(void *full_pk_ptr, unsigned int full_pk_len,
 		.convert_pk = _convert_pk \
 	}
 
+/* Macro to register a cryptographic library with incremental hashing */
+#define REGISTER_CRYPTO_LIB_HASH_STREAM(_name, _init, _verify_signature, \
+			    _verify_hash, _calc_hash, _auth_decrypt, \
+			    _convert_pk, _calc_hash_start, _calc_hash_update, \
+			    _calc_hash_finish) \
+	const crypto_lib_desc_t crypto_lib_desc = { \
+		.name = _name, \
+		.init = _init, \
+		.verify_signature = _verify_signature, \
+		.verify_hash = _verify_hash, \
+		.calc_hash = _calc_hash, \
+		.auth_decrypt = _auth_decrypt, \
+		.convert_pk = _convert_pk, \
+		.calc_hash_start = _calc_hash_start, \
+		.calc_hash_update = _calc_hash_update, \
+		.calc_hash_finish = _calc_hash_finish \
+	}
+
 extern const crypto_lib_desc_t crypto_lib_desc;
 
 #endif /* CRYPTO_MOD_H */
@@ -41,6 +41,9 @@
 
 #define EVLOG_INVALID_ID	UINT32_MAX
 
+/* Number of metadata entries event_log_index_metadata() can index */
+#define EVLOG_MAX_INDEXED	16U
+
 #define MEMBER_SIZE(type, member) sizeof(((type *)0)->member)
 
 typedef struct {
@@ -74,6 +77,7 @@ int event_log_measure(uintptr_t data_base, uint32_t data_size,
 		      unsigned char hash_data[CRYPTO_MD_MAX_SIZE]);
 void event_log_record(const uint8_t *hash, uint32_t event_type,
 		      const event_log_metadata_t *metadata_ptr);
+int event_log_index_metadata(const event_log_metadata_t *metadata_ptr);
 int event_log_measure_and_record(uintptr_t data_base, uint32_t data_size,
 				 uint32_t data_id,
 				 const event_log_metadata_t *metadata_ptr);
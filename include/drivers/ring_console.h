@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef RING_CONSOLE_H
+#define RING_CONSOLE_H
+
+#include <lib/utils_def.h>
+
+#define RING_CONSOLE_MAGIC		U(0x43524654)	/* "TFRC" */
+
+#ifndef __ASSEMBLER__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <drivers/console.h>
+
+/*
+ * Header at the start of the memory given to the ring console, which is
+ * followed by 'size' bytes of log. 'head' counts the bytes written so far,
+ * modulo 2^32, and 'size' is a power of two. The next byte is written at
+ * offset 'head & (size - 1)' of the log, so once 'head' has gone past 'size'
+ * the oldest byte is found there too.
+ */
+struct ring_console_hdr {
+	uint32_t magic;
+	uint32_t size;
+	uint32_t head;
+	uint32_t reserved;
+};
+
+typedef struct {
+	console_t console;
+	/*
+	 * The header can be read and written by the normal world once it
+	 * runs, so the positions used by the driver are kept here.
+	 */
+	struct ring_console_hdr *hdr;
+	uint8_t *log;
+	uint32_t size;
+	uint32_t head;
+	uint32_t tail;
+	/* Console the log is drained into, and how to write to it */
+	console_t *uart;
+	int (*uart_try_putc)(int c, console_t *uart);
+} console_ring_t;
+
+/*
+ * Register a console which writes to the memory at 'base' and carries on from
+ * the log already there, if any.
+ */
+int console_ring_register(uintptr_t base, size_t size, console_ring_t *ring);
+
+/*
+ * Drain the log into 'uart', which must not be registered itself, or stop
+ * draining it if 'uart' is NULL. 'try_putc' must write a character only if
+ * that can be done without waiting, and return a negative value otherwise.
+ */
+void console_ring_set_uart(console_ring_t *ring, console_t *uart,
+			   int (*try_putc)(int c, console_t *uart));
+
+/* Write as much of the log to the UART as it takes without waiting */
+void console_ring_drain(console_ring_t *ring);
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* RING_CONSOLE_H */
@@ -7,6 +7,9 @@
 #ifndef DEBUGFS_H
 #define DEBUGFS_H
 
+#include <cdefs.h>
+#include <stddef.h>
+
 #define NAMELEN   13 /* Maximum length of a file name */
 #define PATHLEN   41 /* Maximum length of a path */
 #define STATLEN   41 /* Size of static part of dir format */
@@ -58,6 +61,27 @@ int stat(const char *path, dir_t *dir);
 void debugfs_init(void);
 int debugfs_smc_setup(void);
 
+/*******************************************************************************
+ * The stats device ('#S') exposes read-only text files, regenerated each time
+ * one is read from its start. Platforms add their own files to it through
+ * plat_debugfs_stats_files().
+ ******************************************************************************/
+typedef struct {
+	char	*buf;
+	size_t	size;
+	size_t	len;
+} debugfs_text_t;
+
+typedef struct {
+	char	name[NAMELEN];
+	void	(*show)(debugfs_text_t *text);
+} debugfs_stats_file_t;
+
+void debugfs_text_printf(debugfs_text_t *text, const char *fmt, ...)
+	__printflike(2, 3);
+
+const debugfs_stats_file_t *plat_debugfs_stats_files(unsigned int *count);
+
 /* Debugfs version returned through SMC interface */
 #define DEBUGFS_VERSION		(0x000000001U)
 
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef PSCI_STAT_HIST_H
+#define PSCI_STAT_HIST_H
+
+#include <stdint.h>
+
+#include <lib/smccc.h>
+#include <lib/utils_def.h>
+
+/*
+ * Residencies are counted in log2 buckets of microseconds: bucket 0 holds
+ * those below 16us, bucket n those from 2^(n + 3)us to 2^(n + 4)us, and the
+ * last bucket those of 2^16us (65ms) and above.
+ */
+#define PSCI_STAT_HIST_BUCKETS		U(14)
+#define PSCI_STAT_HIST_MIN_SHIFT	U(4)
+
+/*
+ * Defines for the PSCI_STAT_HISTOGRAM SMC function ids used with
+ * Vendor-Specific EL3 range. Both take the same arguments as
+ * PSCI_STAT_RESIDENCY and PSCI_STAT_COUNT.
+ */
+#define PSCI_STAT_HIST_RESIDENCY_64	U(0xC7000030)
+#define PSCI_STAT_HIST_LATENCY_64	U(0xC7000031)
+#define PSCI_STAT_HIST_VERSION_64	U(0xC7000032)
+
+#define PSCI_STAT_HIST_VERSION		U(0x00000001)
+
+/*
+ * The macros below are used to identify
+ * PSCI_STAT_HISTOGRAM calls from the SMC function ID.
+ */
+#define PSCI_STAT_HIST_FID_VALUE	U(0x30)
+#define PSCI_STAT_HIST_ID_MASK		(FUNCID_NUM_MASK & ~(0xf))
+#define is_psci_stat_hist_fid(_fid) \
+	((GET_SMC_NUM(_fid) & PSCI_STAT_HIST_ID_MASK) == PSCI_STAT_HIST_FID_VALUE)
+
+/*
+ * Statistics of a power domain in a local power state, on top of the
+ * PSCI_STAT residency and count. Latencies are in microseconds: entry from the
+ * PSCI call to the last timestamp before the power down, exit from the first
+ * timestamp after the wake up to the statistics update, which follows the
+ * platform power up hooks on a warm boot and precedes them on a retention
+ * exit. They are only measured for the 'latencies' entries which went
+ * through a PSCI call.
+ */
+typedef struct psci_stat_hist {
+	uint32_t residency[PSCI_STAT_HIST_BUCKETS];
+	uint32_t latencies;
+	uint32_t entry_max;
+	uint32_t exit_max;
+	uint64_t entry_total;
+	uint64_t exit_total;
+} psci_stat_hist_t;
+
+uintptr_t psci_stat_hist_smc_handler(unsigned int smc_fid,
+		u_register_t x1,
+		u_register_t x2,
+		u_register_t x3,
+		u_register_t x4,
+		void *cookie,
+		void *handle,
+		u_register_t flags);
+
+#endif /* PSCI_STAT_HIST_H */
@@ -337,6 +337,30 @@ int mmap_remove_dynamic_region_ctx(xlat_ctx_t *ctx,
 				uintptr_t base_va,
 				size_t size);
 
+/*
+ * Add an array of 'count' dynamic regions with defined base PA and base VA.
+ * The translation tables are synchronized once for the whole batch instead of
+ * once per region. Either all the regions are added or, if any of them fails,
+ * none of them is.
+ *
+ * It returns the same error values as mmap_add_dynamic_region().
+ */
+int mmap_add_dynamic_regions(mmap_region_t *mm, unsigned int count);
+int mmap_add_dynamic_regions_ctx(xlat_ctx_t *ctx, mmap_region_t *mm,
+				 unsigned int count);
+
+/*
+ * Remove an array of 'count' dynamic regions, identified by the base VA and
+ * size of each element. The TLB invalidations of all the regions are completed
+ * with a single synchronization. Either all the regions are removed or, if any
+ * of them can't be, none of them is.
+ *
+ * It returns the same error values as mmap_remove_dynamic_region().
+ */
+int mmap_remove_dynamic_regions(const mmap_region_t *mm, unsigned int count);
+int mmap_remove_dynamic_regions_ctx(xlat_ctx_t *ctx, const mmap_region_t *mm,
+				    unsigned int count);
+
 #endif /* PLAT_XLAT_TABLES_DYNAMIC */
 
 /*
@@ -412,5 +436,23 @@ int xlat_get_mem_attributes_ctx(const xlat_ctx_t *ctx, uintptr_t base_va,
 				uint32_t *attr);
 int xlat_get_mem_attributes(uintptr_t base_va, uint32_t *attr);
 
+/*
+ * Number of memory regions and translation tables in use in a translation
+ * context, and how many of each it has room for.
+ */
+typedef struct xlat_usage {
+	int mmap_regions;
+	int mmap_regions_max;
+	int tables;
+	int tables_max;
+} xlat_usage_t;
+
+/*
+ * Fill in *usage for a translation context, e.g. to check how much headroom
+ * MAX_MMAP_REGIONS and MAX_XLAT_TABLES leave once dynamic regions are mapped.
+ */
+void xlat_get_usage_ctx(const xlat_ctx_t *ctx, xlat_usage_t *usage);
+void xlat_get_usage(xlat_usage_t *usage);
+
 #endif /*__ASSEMBLER__*/
 #endif /* XLAT_TABLES_V2_H */
@@ -167,6 +167,15 @@ const char *plat_log_get_prefix(unsigned int log_level);
 void bl2_plat_preload_setup(void);
 void plat_setup_try_img_ops(const struct plat_try_images_ops *plat_try_ops);
 
+#if IMAGE_HASH_ON_LOAD
+int plat_image_hash_update(void *data_ptr, unsigned int data_len);
+int plat_image_hash_wait(void);
+#endif
+
+#if TRUSTED_BOARD_BOOT
+int plat_defer_image_auth(unsigned int image_id, image_info_t *image_data);
+#endif
+
 #if MEASURED_BOOT
 int plat_mboot_measure_image(unsigned int image_id, image_info_t *image_data);
 int plat_mboot_measure_critical_data(unsigned int critical_data_id,
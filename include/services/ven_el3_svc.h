@@ -21,7 +21,7 @@
 #define VEN_EL3_SVC_VERSION	0x8700ff03
 
 #define VEN_EL3_SVC_VERSION_MAJOR	1
-#define VEN_EL3_SVC_VERSION_MINOR	0
+#define VEN_EL3_SVC_VERSION_MINOR	1
 
 /* DEBUGFS_SMC_32		0x87000010U */
 /* DEBUGFS_SMC_64		0xC7000010U */
@@ -29,4 +29,8 @@
 /* PMF_SMC_GET_TIMESTAMP_32	0x87000020U */
 /* PMF_SMC_GET_TIMESTAMP_64	0xC7000020U */
 
+/* PSCI_STAT_HIST_RESIDENCY_64	0xC7000030U */
+/* PSCI_STAT_HIST_LATENCY_64	0xC7000031U */
+/* PSCI_STAT_HIST_VERSION_64	0xC7000032U */
+
 #endif /* VEN_EL3_SVC_H */
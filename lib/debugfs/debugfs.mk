@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2019, Arm Limited and Contributors. All rights reserved.
+# Copyright (c) 2019-2026, Arm Limited and Contributors. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -8,6 +8,7 @@ DEBUGFS_SRCS	:=	$(addprefix lib/debugfs/,	\
 			dev.c				\
 			devc.c				\
 			devroot.c			\
-			devfip.c)
+			devfip.c			\
+			devstats.c)
 
 DEBUGFS_SRCS    += lib/debugfs/debugfs_smc.c
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, Arm Limited. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -8,10 +8,12 @@ typedef struct dev dev_t;
 
 extern dev_t rootdevtab;
 extern dev_t fipdevtab;
+extern dev_t statsdevtab;
 
 dev_t *const devtab[] = {
 	&rootdevtab,
 	&fipdevtab,
+	&statsdevtab,
 	0
 };
 
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+
+#include <common/debug.h>
+#include <lib/debugfs.h>
+#include <lib/xlat_tables/xlat_tables_v2.h>
+
+#include "dev.h"
+
+#define STATS_QXLAT	0
+#define STATS_BUF_SIZE	2048
+
+#pragma weak plat_debugfs_stats_files
+
+/*******************************************************************************
+ * The text of the file read last. It is only regenerated when a file is read
+ * from its start or another file is read, so that a file read in several
+ * chunks stays consistent.
+ ******************************************************************************/
+static char stats_buf[STATS_BUF_SIZE];
+static debugfs_text_t stats_text = {
+	.buf = stats_buf,
+	.size = sizeof(stats_buf),
+};
+static qid_t stats_qid = CHDIR;
+
+const debugfs_stats_file_t *plat_debugfs_stats_files(unsigned int *count)
+{
+	*count = 0U;
+
+	return NULL;
+}
+
+/*******************************************************************************
+ * This function appends formatted text to a stats file, dropping what does
+ * not fit.
+ ******************************************************************************/
+void debugfs_text_printf(debugfs_text_t *text, const char *fmt, ...)
+{
+	va_list args;
+	int n;
+
+	if (text->len >= (text->size - 1U)) {
+		return;
+	}
+
+	va_start(args, fmt);
+	n = vsnprintf(text->buf + text->len, text->size - text->len, fmt, args);
+	va_end(args);
+
+	if (n > 0) {
+		text->len += n;
+		if (text->len > (text->size - 1U)) {
+			text->len = text->size - 1U;
+		}
+	}
+}
+
+/*******************************************************************************
+ * This function shows how much of MAX_MMAP_REGIONS and MAX_XLAT_TABLES the
+ * BL31 translation context uses.
+ ******************************************************************************/
+static void xlat_show(debugfs_text_t *text)
+{
+	xlat_usage_t usage;
+
+	xlat_get_usage(&usage);
+
+	debugfs_text_printf(text, "mmap_regions %d/%d\n",
+			    usage.mmap_regions, usage.mmap_regions_max);
+	debugfs_text_printf(text, "xlat_tables %d/%d\n",
+			    usage.tables, usage.tables_max);
+}
+
+/*******************************************************************************
+ * This function returns the generator of the file identified by qid, the
+ * xlat file first and then those of the platform.
+ ******************************************************************************/
+static const debugfs_stats_file_t *stats_file(qid_t qid)
+{
+	static const debugfs_stats_file_t xlat_file = {"xlat", xlat_show};
+	const debugfs_stats_file_t *files;
+	unsigned int count;
+
+	if (qid == STATS_QXLAT) {
+		return &xlat_file;
+	}
+
+	files = plat_debugfs_stats_files(&count);
+	if ((files == NULL) || ((qid - 1U) >= count)) {
+		return NULL;
+	}
+
+	return &files[qid - 1U];
+}
+
+/*******************************************************************************
+ * This function exposes the stats files of the device directory.
+ ******************************************************************************/
+static int statsgen(chan_t *channel, const dirtab_t *tab, int ntab,
+		    int n, dir_t *dir)
+{
+	const debugfs_stats_file_t *file = stats_file(n);
+
+	if (file == NULL) {
+		return 0;
+	}
+
+	make_dir_entry(channel, dir, file->name, 0, n, O_READ);
+	return 1;
+}
+
+static int statswalk(chan_t *channel, const char *name)
+{
+	return devwalk(channel, name, NULL, 0, statsgen);
+}
+
+static int statsstat(chan_t *channel, const char *file, dir_t *dir)
+{
+	return devstat(channel, file, dir, NULL, 0, statsgen);
+}
+
+/*******************************************************************************
+ * This function copies at most size bytes of the stats file referred by
+ * channel into buf.
+ ******************************************************************************/
+static int statsread(chan_t *channel, void *buf, int size)
+{
+	const debugfs_stats_file_t *file;
+
+	if ((channel->qid & CHDIR) != 0) {
+		if (size < sizeof(dir_t)) {
+			return -1;
+		}
+
+		return dirread(channel, buf, NULL, 0, statsgen);
+	}
+
+	file = stats_file(channel->qid);
+	if (file == NULL) {
+		return -1;
+	}
+
+	if ((channel->offset == 0) || (channel->qid != stats_qid)) {
+		stats_text.len = 0U;
+		stats_buf[0] = '\0';
+		file->show(&stats_text);
+		stats_qid = channel->qid;
+	}
+
+	return buf_to_channel(channel, buf, stats_buf, size, stats_text.len);
+}
+
+const dev_t statsdevtab = {
+	.id = 'S',
+	.stat = statsstat,
+	.clone = devclone,
+	.attach = devattach,
+	.walk = statswalk,
+	.read = statsread,
+	.write = deverrwrite,
+	.mount = deverrmount,
+	.seek = devseek
+};
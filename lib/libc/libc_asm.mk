@@ -7,7 +7,17 @@
 include lib/libc/libc_common.mk
 
 ifeq (${ARCH},aarch64)
+LIBC_SRCS	:=	$(filter-out $(addprefix lib/libc/,	\
+			memchr.c				\
+			memcmp.c				\
+			memcpy.c				\
+			memmove.c), $(LIBC_SRCS))
+
 LIBC_SRCS	+=	$(addprefix lib/libc/aarch64/,	\
+			memchr.S			\
+			memcmp.S			\
+			memcpy.S			\
+			memmove.S			\
 			memset.S)
 else
 LIBC_SRCS	+=	$(addprefix lib/libc/aarch32/,	\
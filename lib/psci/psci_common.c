@@ -1008,6 +1008,7 @@ void psci_warmboot_entrypoint(void)
 
 #if ENABLE_PSCI_STAT
 	plat_psci_stat_accounting_stop(&state_info);
+	psci_stats_timestamp(PSCI_STAT_TS_EXIT);
 #endif
 
 	/*
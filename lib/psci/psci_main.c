@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -64,6 +64,8 @@ int psci_cpu_suspend(unsigned int power_state,
 	plat_local_state_t prev[PLAT_MAX_PWR_LVL];
 #endif
 
+	psci_stats_timestamp(PSCI_STAT_TS_REQUEST);
+
 	/* Validate the power_state parameter */
 	rc = psci_validate_power_state(power_state, &state_info);
 	if (rc != PSCI_E_SUCCESS) {
@@ -112,6 +114,7 @@ int psci_cpu_suspend(unsigned int power_state,
 
 #if ENABLE_PSCI_STAT
 		plat_psci_stat_accounting_start(&state_info);
+		psci_stats_timestamp(PSCI_STAT_TS_ENTER);
 #endif
 
 #if ENABLE_RUNTIME_INSTRUMENTATION
@@ -143,6 +146,7 @@ int psci_cpu_suspend(unsigned int power_state,
 
 #if ENABLE_PSCI_STAT
 		plat_psci_stat_accounting_stop(&state_info);
+		psci_stats_timestamp(PSCI_STAT_TS_EXIT);
 
 		/* Update PSCI stats */
 		psci_stats_update_pwr_up(PSCI_CPU_PWR_LVL, &state_info);
@@ -182,6 +186,8 @@ int psci_system_suspend(uintptr_t entrypoint, u_register_t context_id)
 	psci_power_state_t state_info;
 	entry_point_info_t ep;
 
+	psci_stats_timestamp(PSCI_STAT_TS_REQUEST);
+
 	/* Check if the current CPU is the last ON CPU in the system */
 	if (!psci_is_last_on_cpu())
 		return PSCI_E_DENIED;
@@ -232,6 +238,8 @@ int psci_cpu_off(void)
 	int rc;
 	unsigned int target_pwrlvl = PLAT_MAX_PWR_LVL;
 
+	psci_stats_timestamp(PSCI_STAT_TS_REQUEST);
+
 	/*
 	 * Do what is needed to power off this CPU and possible higher power
 	 * levels if it able to do so. Upon success, enter the final wfi
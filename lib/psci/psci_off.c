@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2019, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, ARM Limited and Contributors. All rights reserved.
  * Copyright (c) 2023, NVIDIA Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -142,6 +142,7 @@ int psci_do_cpu_off(unsigned int end_pwrlvl)
 
 #if ENABLE_PSCI_STAT
 	plat_psci_stat_accounting_start(&state_info);
+	psci_stats_timestamp(PSCI_STAT_TS_ENTER);
 #endif
 
 exit:
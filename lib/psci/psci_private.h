@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -15,6 +15,7 @@
 #include <lib/bakery_lock.h>
 #include <lib/el3_runtime/cpu_data.h>
 #include <lib/psci/psci.h>
+#include <lib/psci/psci_stat_hist.h>
 #include <lib/spinlock.h>
 
 /*
@@ -369,6 +370,22 @@ u_register_t psci_stat_residency(u_register_t target_cpu,
 u_register_t psci_stat_count(u_register_t target_cpu,
 			unsigned int power_state);
 
+/* Timestamps taken by each CPU for the PSCI_STAT_HISTOGRAM latencies */
+#define PSCI_STAT_TS_REQUEST	U(0)
+#define PSCI_STAT_TS_ENTER	U(1)
+#define PSCI_STAT_TS_EXIT	U(2)
+#define PSCI_STAT_TS_COUNT	U(3)
+
+#if PSCI_STAT_HISTOGRAM
+void psci_stats_timestamp(unsigned int ts_id);
+int psci_stat_hist(u_register_t target_cpu, unsigned int power_state,
+			psci_stat_hist_t *hist);
+#else
+static inline void psci_stats_timestamp(unsigned int ts_id)
+{
+}
+#endif
+
 /* Private exported functions from psci_mem_protect.c */
 u_register_t psci_mem_protect(unsigned int enable);
 u_register_t psci_mem_chk_range(uintptr_t base, u_register_t length);
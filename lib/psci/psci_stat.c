@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2019, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -21,8 +21,24 @@
 typedef struct psci_stat {
 	u_register_t residency;
 	u_register_t count;
+#if PSCI_STAT_HISTOGRAM
+	psci_stat_hist_t hist;
+#endif
 } psci_stat_t;
 
+#if PSCI_STAT_HISTOGRAM
+/*
+ * Timestamps of the last low power state entered by each CPU. The enter
+ * timestamp may be taken with the data cache off, so these are written back
+ * to memory once taken and invalidated before being read.
+ */
+typedef struct psci_stat_ts {
+	unsigned long long ts[PSCI_STAT_TS_COUNT];
+} __aligned(CACHE_WRITEBACK_GRANULE) psci_stat_ts_t;
+
+static psci_stat_ts_t psci_stat_ts[PLATFORM_CORE_COUNT];
+#endif
+
 /*
  * Following is used to keep track of the last cpu
  * that goes to power down in non cpu power domains.
@@ -62,6 +78,77 @@ static int get_stat_idx(plat_local_state_t local_state, unsigned int pwr_lvl)
 	return idx;
 }
 
+#if PSCI_STAT_HISTOGRAM
+/* Take one of the PSCI_STAT_TS_* timestamps of this CPU */
+void psci_stats_timestamp(unsigned int ts_id)
+{
+	psci_stat_ts_t *ts = &psci_stat_ts[plat_my_core_pos()];
+
+	assert(ts_id < PSCI_STAT_TS_COUNT);
+
+	ts->ts[ts_id] = read_cntpct_el0();
+	flush_dcache_range((uintptr_t)ts, sizeof(*ts));
+}
+
+static uint32_t psci_stat_ticks_to_us(unsigned long long ticks)
+{
+	return (uint32_t)((ticks * 1000000ULL) / read_cntfrq_el0());
+}
+
+static unsigned int psci_stat_hist_bucket(u_register_t residency)
+{
+	u_register_t us = residency >> PSCI_STAT_HIST_MIN_SHIFT;
+	unsigned int bucket;
+
+	for (bucket = 0U; (us != 0U) && (bucket < (PSCI_STAT_HIST_BUCKETS - 1U));
+	     bucket++) {
+		us >>= 1;
+	}
+
+	return bucket;
+}
+
+/*
+ * Count a residency in the histogram of 'stat'. The entry latency is the one
+ * of 'down_idx', the last CPU to power down the domain, and the exit latency
+ * the one of this CPU, which ends 'now'.
+ */
+static void psci_stat_hist_update(psci_stat_t *stat, u_register_t residency,
+				  unsigned int down_idx, unsigned long long now)
+{
+	psci_stat_hist_t *hist = &stat->hist;
+	const psci_stat_ts_t *down = &psci_stat_ts[down_idx];
+	const psci_stat_ts_t *up = &psci_stat_ts[plat_my_core_pos()];
+	unsigned long long request, enter, exit;
+	uint32_t entry_us, exit_us;
+
+	hist->residency[psci_stat_hist_bucket(residency)]++;
+
+	inv_dcache_range((uintptr_t)down, sizeof(*down));
+	request = down->ts[PSCI_STAT_TS_REQUEST];
+	enter = down->ts[PSCI_STAT_TS_ENTER];
+	exit = up->ts[PSCI_STAT_TS_EXIT];
+
+	/* A CPU not powered down through a PSCI call, e.g. at cold boot */
+	if ((request == 0ULL) || (enter < request) || (exit < enter)) {
+		return;
+	}
+
+	entry_us = psci_stat_ticks_to_us(enter - request);
+	exit_us = psci_stat_ticks_to_us(now - exit);
+
+	hist->latencies++;
+	hist->entry_total += entry_us;
+	hist->exit_total += exit_us;
+	if (entry_us > hist->entry_max) {
+		hist->entry_max = entry_us;
+	}
+	if (exit_us > hist->exit_max) {
+		hist->exit_max = exit_us;
+	}
+}
+#endif /* PSCI_STAT_HISTOGRAM */
+
 /*******************************************************************************
  * This function is passed the target local power states for each power
  * domain (state_info) between the current CPU domain and its ancestors until
@@ -114,6 +201,10 @@ void psci_stats_update_pwr_up(unsigned int end_pwrlvl,
 	int stat_idx;
 	plat_local_state_t local_state;
 	u_register_t residency;
+#if PSCI_STAT_HISTOGRAM
+	unsigned long long now = read_cntpct_el0();
+	psci_stat_ts_t *ts = &psci_stat_ts[cpu_idx];
+#endif
 
 	assert(end_pwrlvl <= PLAT_MAX_PWR_LVL);
 	assert(state_info != NULL);
@@ -129,6 +220,10 @@ void psci_stats_update_pwr_up(unsigned int end_pwrlvl,
 	/* Update CPU stats. */
 	psci_cpu_stat[cpu_idx][stat_idx].residency += residency;
 	psci_cpu_stat[cpu_idx][stat_idx].count++;
+#if PSCI_STAT_HISTOGRAM
+	psci_stat_hist_update(&psci_cpu_stat[cpu_idx][stat_idx], residency,
+			      cpu_idx, now);
+#endif
 
 	/*
 	 * Check what power domains above CPU were off
@@ -137,7 +232,7 @@ void psci_stats_update_pwr_up(unsigned int end_pwrlvl,
 	parent_idx = psci_cpu_pd_nodes[cpu_idx].parent_node;
 	/* Return early if this is the first power up. */
 	if (last_cpu_in_non_cpu_pd[parent_idx] == -1)
-		return;
+		goto out;
 
 	for (lvl = PSCI_CPU_PWR_LVL + 1U; lvl <= end_pwrlvl; lvl++) {
 		local_state = state_info->pwr_domain_state[lvl];
@@ -152,19 +247,31 @@ void psci_stats_update_pwr_up(unsigned int end_pwrlvl,
 		residency = plat_psci_stat_get_residency(lvl, state_info,
 			(unsigned int)last_cpu_in_non_cpu_pd[parent_idx]);
 
-		/* Initialize back to reset value */
-		last_cpu_in_non_cpu_pd[parent_idx] = -1;
-
 		/* Get the index into the stats array */
 		stat_idx = get_stat_idx(local_state, lvl);
 
 		/* Update non cpu stats */
 		psci_non_cpu_stat[parent_idx][stat_idx].residency += residency;
 		psci_non_cpu_stat[parent_idx][stat_idx].count++;
+#if PSCI_STAT_HISTOGRAM
+		psci_stat_hist_update(&psci_non_cpu_stat[parent_idx][stat_idx],
+			residency,
+			(unsigned int)last_cpu_in_non_cpu_pd[parent_idx], now);
+#endif
+
+		/* Initialize back to reset value */
+		last_cpu_in_non_cpu_pd[parent_idx] = -1;
 
 		parent_idx = psci_non_cpu_pd_nodes[parent_idx].parent_node;
 	}
 
+out:
+#if PSCI_STAT_HISTOGRAM
+	/* The latencies of this power down are accounted for */
+	ts->ts[PSCI_STAT_TS_REQUEST] = 0ULL;
+	flush_dcache_range((uintptr_t)ts, sizeof(*ts));
+#endif
+	return;
 }
 
 /*******************************************************************************
@@ -225,6 +332,29 @@ static int psci_get_stat(u_register_t target_cpu, unsigned int power_state,
 	return PSCI_E_SUCCESS;
 }
 
+#if PSCI_STAT_HISTOGRAM
+/*
+ * Copy the histogram and latencies of the node and local state found as for
+ * PSCI_STAT_RESIDENCY.
+ */
+int psci_stat_hist(u_register_t target_cpu, unsigned int power_state,
+		   psci_stat_hist_t *hist)
+{
+	psci_stat_t psci_stat;
+	int rc;
+
+	/* Validate the target cpu */
+	if (!is_valid_mpidr(target_cpu))
+		return PSCI_E_INVALID_PARAMS;
+
+	rc = psci_get_stat(target_cpu, power_state, &psci_stat);
+	if (rc == PSCI_E_SUCCESS)
+		*hist = psci_stat.hist;
+
+	return rc;
+}
+#endif
+
 /* This is the top level function for PSCI_STAT_RESIDENCY SMC. */
 u_register_t psci_stat_residency(u_register_t target_cpu,
 		unsigned int power_state)
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <common/debug.h>
+#include <lib/cassert.h>
+#include <lib/psci/psci_stat_hist.h>
+#include <plat/common/platform.h>
+#include <smccc_helpers.h>
+
+#include "psci_private.h"
+
+/* The whole histogram is returned in x1 - x7, two buckets per register */
+CASSERT(PSCI_STAT_HIST_BUCKETS == 14U, assert_psci_stat_hist_buckets);
+
+#define HIST_PAIR(_hist, _n)	\
+	((u_register_t)(_hist).residency[(_n)] |	\
+	 ((u_register_t)(_hist).residency[(_n) + 1U] << 32))
+
+/*
+ * This function is responsible for handling all PSCI_STAT_HISTOGRAM SMC calls.
+ */
+uintptr_t psci_stat_hist_smc_handler(unsigned int smc_fid,
+			u_register_t x1,
+			u_register_t x2,
+			u_register_t x3,
+			u_register_t x4,
+			void *cookie,
+			void *handle,
+			u_register_t flags)
+{
+	psci_stat_hist_t hist;
+
+	switch (smc_fid) {
+	case PSCI_STAT_HIST_RESIDENCY_64:
+		if (psci_stat_hist(x1, (unsigned int)x2, &hist) !=
+		    PSCI_E_SUCCESS) {
+			SMC_RET1(handle, PSCI_E_INVALID_PARAMS);
+		}
+
+		/*
+		 * x0 --> error code.
+		 * x1 - x7 --> buckets 2n and 2n + 1 in the low and high
+		 * halves of register n + 1.
+		 */
+		SMC_RET8(handle, SMC_OK, HIST_PAIR(hist, 0U),
+			 HIST_PAIR(hist, 2U), HIST_PAIR(hist, 4U),
+			 HIST_PAIR(hist, 6U), HIST_PAIR(hist, 8U),
+			 HIST_PAIR(hist, 10U), HIST_PAIR(hist, 12U));
+
+	case PSCI_STAT_HIST_LATENCY_64:
+		if (psci_stat_hist(x1, (unsigned int)x2, &hist) !=
+		    PSCI_E_SUCCESS) {
+			SMC_RET1(handle, PSCI_E_INVALID_PARAMS);
+		}
+
+		/*
+		 * x0 --> error code.
+		 * x1 --> number of latencies measured.
+		 * x2 - x3 --> total and longest entry latency.
+		 * x4 - x5 --> total and longest exit latency.
+		 */
+		SMC_RET6(handle, SMC_OK, hist.latencies, hist.entry_total,
+			 hist.entry_max, hist.exit_total, hist.exit_max);
+
+	case PSCI_STAT_HIST_VERSION_64:
+		SMC_RET2(handle, SMC_OK, PSCI_STAT_HIST_VERSION);
+
+	default:
+		break;
+	}
+
+	WARN("Unimplemented PSCI_STAT_HISTOGRAM Call: 0x%x\n", smc_fid);
+	SMC_RET1(handle, SMC_UNK);
+}
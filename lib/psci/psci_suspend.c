@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2022, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -45,6 +45,7 @@ static void psci_suspend_to_standby_finisher(unsigned int cpu_idx,
 
 #if ENABLE_PSCI_STAT
 	plat_psci_stat_accounting_stop(&state_info);
+	psci_stats_timestamp(PSCI_STAT_TS_EXIT);
 	psci_stats_update_pwr_up(end_pwrlvl, &state_info);
 #endif
 
@@ -251,6 +252,7 @@ int psci_cpu_suspend_start(const entry_point_info_t *ep,
 
 #if ENABLE_PSCI_STAT
 	plat_psci_stat_accounting_start(state_info);
+	psci_stats_timestamp(PSCI_STAT_TS_ENTER);
 #endif
 
 exit:
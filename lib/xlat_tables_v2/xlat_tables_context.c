@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -90,6 +90,16 @@ int mmap_remove_dynamic_region(uintptr_t base_va, size_t size)
 					base_va, size);
 }
 
+int mmap_add_dynamic_regions(mmap_region_t *mm, unsigned int count)
+{
+	return mmap_add_dynamic_regions_ctx(&tf_xlat_ctx, mm, count);
+}
+
+int mmap_remove_dynamic_regions(const mmap_region_t *mm, unsigned int count)
+{
+	return mmap_remove_dynamic_regions_ctx(&tf_xlat_ctx, mm, count);
+}
+
 #endif /* PLAT_XLAT_TABLES_DYNAMIC */
 
 void __init init_xlat_tables(void)
@@ -120,6 +130,11 @@ int xlat_change_mem_attributes(uintptr_t base_va, size_t size, uint32_t attr)
 	return xlat_change_mem_attributes_ctx(&tf_xlat_ctx, base_va, size, attr);
 }
 
+void xlat_get_usage(xlat_usage_t *usage)
+{
+	xlat_get_usage_ctx(&tf_xlat_ctx, usage);
+}
+
 #if PLAT_RO_XLAT_TABLES
 /* Change the memory attributes of the descriptors which resolve the address
  * range that belongs to the translation tables themselves, which are by default
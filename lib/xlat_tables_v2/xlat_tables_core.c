@@ -771,9 +771,44 @@ static int mmap_add_region_check(const xlat_ctx_t *ctx, const mmap_region_t *mm)
 	return 0;
 }
 
+/*
+ * Returns the index of the first entry of the mmap array that sorts after a
+ * region ending at 'end_va' with the given size, following the ordering
+ * described in mmap_add_region_ctx(). Empty entries are all at the end of the
+ * array and sort after everything else, so a binary search over the whole
+ * array is enough and there is no need to find the last used entry first.
+ *
+ * If 'size' is 0, the first entry whose end VA is not below 'end_va' is
+ * returned instead, which is the first candidate when looking up a region.
+ */
+static unsigned int mmap_bsearch(const xlat_ctx_t *ctx, uintptr_t end_va,
+				 size_t size)
+{
+	unsigned int lo = 0U;
+	unsigned int hi = ctx->mmap_num;
+
+	while (lo < hi) {
+		unsigned int mid = lo + ((hi - lo) / 2U);
+		const mmap_region_t *mm_cursor = &ctx->mmap[mid];
+		uintptr_t mm_cursor_end_va = mm_cursor->base_va
+						+ mm_cursor->size - 1U;
+
+		if ((mm_cursor->size != 0U) &&
+		    ((mm_cursor_end_va < end_va) ||
+		     ((mm_cursor_end_va == end_va) &&
+		      (mm_cursor->size < size)))) {
+			lo = mid + 1U;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
 void mmap_add_region_ctx(xlat_ctx_t *ctx, const mmap_region_t *mm)
 {
-	mmap_region_t *mm_cursor = ctx->mmap, *mm_destination;
+	mmap_region_t *mm_cursor, *mm_destination;
 	const mmap_region_t *mm_end = ctx->mmap + ctx->mmap_num;
 	const mmap_region_t *mm_last;
 	unsigned long long end_pa = mm->base_pa + mm->size - 1U;
@@ -817,16 +852,7 @@ void mmap_add_region_ctx(xlat_ctx_t *ctx, const mmap_region_t *mm)
 	 *
 	 * Overlapping is only allowed for static regions.
 	 */
-
-	while (((mm_cursor->base_va + mm_cursor->size - 1U) < end_va)
-	       && (mm_cursor->size != 0U)) {
-		++mm_cursor;
-	}
-
-	while (((mm_cursor->base_va + mm_cursor->size - 1U) == end_va) &&
-	       (mm_cursor->size != 0U) && (mm_cursor->size < mm->size)) {
-		++mm_cursor;
-	}
+	mm_cursor = &ctx->mmap[mmap_bsearch(ctx, end_va, mm->size)];
 
 	/*
 	 * Find the last entry marker in the mmap
@@ -949,10 +975,47 @@ void mmap_add_ctx(xlat_ctx_t *ctx, const mmap_region_t *mm)
 
 #if PLAT_XLAT_TABLES_DYNAMIC
 
-int mmap_add_dynamic_region_ctx(xlat_ctx_t *ctx, mmap_region_t *mm)
+/*
+ * Clean the base translation table so that the table walker observes the
+ * descriptors written by the dynamic mapping functions.
+ */
+static void xlat_tables_clean_base_table(const xlat_ctx_t *ctx)
 {
-	mmap_region_t *mm_cursor = ctx->mmap;
-	const mmap_region_t *mm_last = mm_cursor + ctx->mmap_num;
+#if !(HW_ASSISTED_COHERENCY || WARMBOOT_ENABLE_DCACHE_EARLY)
+	xlat_clean_dcache_range((uintptr_t)ctx->base_table,
+			   ctx->base_table_entries * sizeof(uint64_t));
+#endif
+}
+
+/*
+ * Returns the entry of the mmap array with the given base VA and size, or NULL
+ * if there is none. The mmap array is sorted by end VA, so the lookup is a
+ * binary search followed by a scan of the (few) regions sharing that end VA.
+ */
+static mmap_region_t *mmap_find_region(const xlat_ctx_t *ctx,
+				       uintptr_t base_va, size_t size)
+{
+	uintptr_t end_va = base_va + size - 1U;
+	mmap_region_t *mm = &ctx->mmap[mmap_bsearch(ctx, end_va, 0U)];
+
+	while ((mm->size != 0U) && ((mm->base_va + mm->size - 1U) == end_va)) {
+		if (mm->base_va == base_va)
+			return mm;
+		++mm;
+	}
+
+	return NULL;
+}
+
+/*
+ * Inserts a dynamic region in the mmap array and, if the translation tables
+ * are initialized, writes its descriptors. The caller must clean the base table
+ * and issue the barrier that publishes the new descriptors.
+ */
+static int mmap_add_dynamic_region_internal(xlat_ctx_t *ctx, mmap_region_t *mm)
+{
+	mmap_region_t *mm_cursor;
+	const mmap_region_t *mm_last = ctx->mmap + ctx->mmap_num;
 	unsigned long long end_pa = mm->base_pa + mm->size - 1U;
 	uintptr_t end_va = mm->base_va + mm->size - 1U;
 	int ret;
@@ -972,16 +1035,7 @@ int mmap_add_dynamic_region_ctx(xlat_ctx_t *ctx, mmap_region_t *mm)
 	 * Find the adequate entry in the mmap array in the same way done for
 	 * static regions in mmap_add_region_ctx().
 	 */
-
-	while (((mm_cursor->base_va + mm_cursor->size - 1U) < end_va)
-	       && (mm_cursor->size != 0U)) {
-		++mm_cursor;
-	}
-
-	while (((mm_cursor->base_va + mm_cursor->size - 1U) == end_va) &&
-	       (mm_cursor->size != 0U) && (mm_cursor->size < mm->size)) {
-		++mm_cursor;
-	}
+	mm_cursor = &ctx->mmap[mmap_bsearch(ctx, end_va, mm->size)];
 
 	/* Make room for new region by moving other regions up by one place */
 	(void)memmove(mm_cursor + 1U, mm_cursor,
@@ -1004,10 +1058,7 @@ int mmap_add_dynamic_region_ctx(xlat_ctx_t *ctx, mmap_region_t *mm)
 		end_va = xlat_tables_map_region(ctx, mm_cursor,
 				0U, ctx->base_table, ctx->base_table_entries,
 				ctx->base_level);
-#if !(HW_ASSISTED_COHERENCY || WARMBOOT_ENABLE_DCACHE_EARLY)
-		xlat_clean_dcache_range((uintptr_t)ctx->base_table,
-				   ctx->base_table_entries * sizeof(uint64_t));
-#endif
+
 		/* Failed to map, remove mmap entry, unmap and return error. */
 		if (end_va != (mm_cursor->base_va + mm_cursor->size - 1U)) {
 			(void)memmove(mm_cursor, mm_cursor + 1U,
@@ -1033,12 +1084,79 @@ int mmap_add_dynamic_region_ctx(xlat_ctx_t *ctx, mmap_region_t *mm)
 			xlat_tables_unmap_region(ctx, &unmap_mm, 0U,
 				ctx->base_table, ctx->base_table_entries,
 				ctx->base_level);
-#if !(HW_ASSISTED_COHERENCY || WARMBOOT_ENABLE_DCACHE_EARLY)
-			xlat_clean_dcache_range((uintptr_t)ctx->base_table,
-				ctx->base_table_entries * sizeof(uint64_t));
-#endif
 			return -ENOMEM;
 		}
+	}
+
+	if (end_pa > ctx->max_pa)
+		ctx->max_pa = end_pa;
+	if (end_va > ctx->max_va)
+		ctx->max_va = end_va;
+
+	return 0;
+}
+
+/*
+ * Unmaps the given entry of the mmap array (if the translation tables are
+ * initialized) and removes it from the array. The caller must clean the base
+ * table and complete the TLB invalidations with xlat_arch_tlbi_va_sync().
+ */
+static void mmap_remove_dynamic_region_internal(xlat_ctx_t *ctx,
+						mmap_region_t *mm)
+{
+	const mmap_region_t *mm_last = ctx->mmap + ctx->mmap_num;
+	bool update_max_va_needed = false;
+	bool update_max_pa_needed = false;
+	unsigned int mmap_used;
+
+	assert((mm->attr & MT_DYNAMIC) != 0U);
+
+	/* Check if this region is using the top VAs or PAs. */
+	if ((mm->base_va + mm->size - 1U) == ctx->max_va)
+		update_max_va_needed = true;
+	if ((mm->base_pa + mm->size - 1U) == ctx->max_pa)
+		update_max_pa_needed = true;
+
+	/* Update the translation tables if needed */
+	if (ctx->initialized) {
+		xlat_tables_unmap_region(ctx, mm, 0U, ctx->base_table,
+					 ctx->base_table_entries,
+					 ctx->base_level);
+	}
+
+	/* Remove this region by moving the rest down by one place. */
+	(void)memmove(mm, mm + 1U, (uintptr_t)mm_last - (uintptr_t)mm);
+
+	/*
+	 * Check if we need to update the max VAs and PAs. The array is sorted
+	 * by end VA, so the highest VA belongs to the last used entry.
+	 */
+	if (update_max_va_needed) {
+		mmap_used = mmap_bsearch(ctx, UINTPTR_MAX, SIZE_MAX);
+		ctx->max_va = 0U;
+		if (mmap_used != 0U) {
+			mm = &ctx->mmap[mmap_used - 1U];
+			ctx->max_va = mm->base_va + mm->size - 1U;
+		}
+	}
+
+	if (update_max_pa_needed) {
+		ctx->max_pa = 0U;
+		mm = ctx->mmap;
+		while (mm->size != 0U) {
+			if ((mm->base_pa + mm->size - 1U) > ctx->max_pa)
+				ctx->max_pa = mm->base_pa + mm->size - 1U;
+			++mm;
+		}
+	}
+}
+
+int mmap_add_dynamic_region_ctx(xlat_ctx_t *ctx, mmap_region_t *mm)
+{
+	int ret = mmap_add_dynamic_region_internal(ctx, mm);
+
+	if (ctx->initialized && (mm->size != 0U)) {
+		xlat_tables_clean_base_table(ctx);
 
 		/*
 		 * Make sure that all entries are written to the memory. There
@@ -1046,15 +1164,11 @@ int mmap_add_dynamic_region_ctx(xlat_ctx_t *ctx, mmap_region_t *mm)
 		 * because new table/block/page descriptors only replace old
 		 * invalid descriptors, that aren't TLB cached.
 		 */
-		dsbishst();
+		if (ret == 0)
+			dsbishst();
 	}
 
-	if (end_pa > ctx->max_pa)
-		ctx->max_pa = end_pa;
-	if (end_va > ctx->max_va)
-		ctx->max_va = end_va;
-
-	return 0;
+	return ret;
 }
 
 int mmap_add_dynamic_region_alloc_va_ctx(xlat_ctx_t *ctx, mmap_region_t *mm)
@@ -1074,6 +1188,50 @@ int mmap_add_dynamic_region_alloc_va_ctx(xlat_ctx_t *ctx, mmap_region_t *mm)
 	return mmap_add_dynamic_region_ctx(ctx, mm);
 }
 
+/*
+ * Adds 'count' dynamic regions. The translation tables are cleaned and the
+ * barrier is issued only once for the whole batch. If any region fails to be
+ * added, the ones added before it are removed again and the error is returned.
+ */
+int mmap_add_dynamic_regions_ctx(xlat_ctx_t *ctx, mmap_region_t *mm,
+				 unsigned int count)
+{
+	unsigned int i;
+	bool rolled_back = false;
+	int ret = 0;
+
+	for (i = 0U; i < count; i++) {
+		ret = mmap_add_dynamic_region_internal(ctx, &mm[i]);
+		if (ret != 0)
+			break;
+	}
+
+	if (ret != 0) {
+		while (i-- > 0U) {
+			mmap_region_t *mm_entry;
+
+			if (mm[i].size == 0U)
+				continue;
+
+			mm_entry = mmap_find_region(ctx, mm[i].base_va,
+						    mm[i].size);
+			assert(mm_entry != NULL);
+			mmap_remove_dynamic_region_internal(ctx, mm_entry);
+			rolled_back = true;
+		}
+	}
+
+	if (ctx->initialized) {
+		xlat_tables_clean_base_table(ctx);
+		if (rolled_back)
+			xlat_arch_tlbi_va_sync();
+		else
+			dsbishst();
+	}
+
+	return ret;
+}
+
 /*
  * Removes the region with given base Virtual Address and size from the given
  * context.
@@ -1086,68 +1244,69 @@ int mmap_add_dynamic_region_alloc_va_ctx(xlat_ctx_t *ctx, mmap_region_t *mm)
 int mmap_remove_dynamic_region_ctx(xlat_ctx_t *ctx, uintptr_t base_va,
 				   size_t size)
 {
-	mmap_region_t *mm = ctx->mmap;
-	const mmap_region_t *mm_last = mm + ctx->mmap_num;
-	int update_max_va_needed = 0;
-	int update_max_pa_needed = 0;
+	mmap_region_t *mm;
 
 	/* Check sanity of mmap array. */
-	assert(mm[ctx->mmap_num].size == 0U);
+	assert(ctx->mmap[ctx->mmap_num].size == 0U);
 
-	while (mm->size != 0U) {
-		if ((mm->base_va == base_va) && (mm->size == size))
-			break;
-		++mm;
-	}
+	mm = mmap_find_region(ctx, base_va, size);
 
 	/* Check that the region was found */
-	if (mm->size == 0U)
+	if (mm == NULL)
 		return -EINVAL;
 
 	/* If the region is static it can't be removed */
 	if ((mm->attr & MT_DYNAMIC) == 0U)
 		return -EPERM;
 
-	/* Check if this region is using the top VAs or PAs. */
-	if ((mm->base_va + mm->size - 1U) == ctx->max_va)
-		update_max_va_needed = 1;
-	if ((mm->base_pa + mm->size - 1U) == ctx->max_pa)
-		update_max_pa_needed = 1;
+	mmap_remove_dynamic_region_internal(ctx, mm);
 
-	/* Update the translation tables if needed */
 	if (ctx->initialized) {
-		xlat_tables_unmap_region(ctx, mm, 0U, ctx->base_table,
-					 ctx->base_table_entries,
-					 ctx->base_level);
-#if !(HW_ASSISTED_COHERENCY || WARMBOOT_ENABLE_DCACHE_EARLY)
-		xlat_clean_dcache_range((uintptr_t)ctx->base_table,
-			ctx->base_table_entries * sizeof(uint64_t));
-#endif
+		xlat_tables_clean_base_table(ctx);
 		xlat_arch_tlbi_va_sync();
 	}
 
-	/* Remove this region by moving the rest down by one place. */
-	(void)memmove(mm, mm + 1U, (uintptr_t)mm_last - (uintptr_t)mm);
+	return 0;
+}
 
-	/* Check if we need to update the max VAs and PAs */
-	if (update_max_va_needed == 1) {
-		ctx->max_va = 0U;
-		mm = ctx->mmap;
-		while (mm->size != 0U) {
-			if ((mm->base_va + mm->size - 1U) > ctx->max_va)
-				ctx->max_va = mm->base_va + mm->size - 1U;
-			++mm;
+/*
+ * Removes 'count' regions, identified by the base VA and size of each entry
+ * of 'mm'. The whole batch is validated before anything is unmapped, so either
+ * all the regions are removed or none of them is. The TLB invalidations of all
+ * the regions are completed with a single synchronization.
+ */
+int mmap_remove_dynamic_regions_ctx(xlat_ctx_t *ctx, const mmap_region_t *mm,
+				    unsigned int count)
+{
+	mmap_region_t *mm_entry;
+
+	/* Check sanity of mmap array. */
+	assert(ctx->mmap[ctx->mmap_num].size == 0U);
+
+	for (unsigned int i = 0U; i < count; i++) {
+		mm_entry = mmap_find_region(ctx, mm[i].base_va, mm[i].size);
+		if (mm_entry == NULL)
+			return -EINVAL;
+
+		if ((mm_entry->attr & MT_DYNAMIC) == 0U)
+			return -EPERM;
+
+		/* Each region can only be removed once. */
+		for (unsigned int j = 0U; j < i; j++) {
+			if (mm[j].base_va == mm[i].base_va)
+				return -EINVAL;
 		}
 	}
 
-	if (update_max_pa_needed == 1) {
-		ctx->max_pa = 0U;
-		mm = ctx->mmap;
-		while (mm->size != 0U) {
-			if ((mm->base_pa + mm->size - 1U) > ctx->max_pa)
-				ctx->max_pa = mm->base_pa + mm->size - 1U;
-			++mm;
-		}
+	for (unsigned int i = 0U; i < count; i++) {
+		mm_entry = mmap_find_region(ctx, mm[i].base_va, mm[i].size);
+		assert(mm_entry != NULL);
+		mmap_remove_dynamic_region_internal(ctx, mm_entry);
+	}
+
+	if (ctx->initialized && (count != 0U)) {
+		xlat_tables_clean_base_table(ctx);
+		xlat_arch_tlbi_va_sync();
 	}
 
 	return 0;
@@ -1185,6 +1344,91 @@ void xlat_setup_dynamic_ctx(xlat_ctx_t *ctx, unsigned long long pa_max,
 
 #endif /* PLAT_XLAT_TABLES_DYNAMIC */
 
+#if XLAT_TABLES_MERGE_REGIONS
+
+/* Returns true if the region overlaps any other region of the mmap array. */
+static bool __init mmap_region_overlaps_others(const xlat_ctx_t *ctx,
+					       const mmap_region_t *mm)
+{
+	uintptr_t end_va = mm->base_va + mm->size - 1U;
+
+	for (const mmap_region_t *mm_cursor = ctx->mmap;
+	     mm_cursor->size != 0U; ++mm_cursor) {
+		if (mm_cursor == mm)
+			continue;
+
+		if ((mm_cursor->base_va <= end_va) &&
+		    ((mm_cursor->base_va + mm_cursor->size - 1U) >=
+		     mm->base_va))
+			return true;
+	}
+
+	return false;
+}
+
+/* Returns true if 'next' can be appended to 'mm' as a single region. */
+static bool __init mmap_regions_mergeable(const xlat_ctx_t *ctx,
+					  const mmap_region_t *mm,
+					  const mmap_region_t *next)
+{
+#if PLAT_XLAT_TABLES_DYNAMIC
+	/* Dynamic regions must keep their identity to be removed later. */
+	if (((mm->attr | next->attr) & MT_DYNAMIC) != 0U)
+		return false;
+#endif
+	if ((mm->attr != next->attr) ||
+	    (mm->granularity != next->granularity))
+		return false;
+
+	if ((next->base_va != (mm->base_va + mm->size)) ||
+	    (next->base_pa != (mm->base_pa + mm->size)))
+		return false;
+
+	/*
+	 * The order in which overlapping static regions are mapped matters, so
+	 * leave them alone.
+	 */
+	return !mmap_region_overlaps_others(ctx, mm) &&
+	       !mmap_region_overlaps_others(ctx, next);
+}
+
+/*
+ * Merge regions that are contiguous in both VA and PA and have the same
+ * attributes. Platforms tend to describe neighbouring peripherals as separate
+ * regions, none of them 2 MB aligned by itself, which forces a level 3 table
+ * around each of them. Once merged, xlat_tables_map_region() can use block
+ * descriptors wherever the combined region covers a whole aligned block, which
+ * saves translation tables and TLB entries.
+ *
+ * Two regions that can be merged are always consecutive in the mmap array:
+ * any region sorted in between would overlap the second one.
+ */
+static void __init mmap_merge_regions(xlat_ctx_t *ctx)
+{
+	mmap_region_t *mm = ctx->mmap;
+	const mmap_region_t *mm_last = ctx->mmap + ctx->mmap_num;
+	unsigned int merged = 0U;
+
+	while ((mm->size != 0U) && (mm[1].size != 0U)) {
+		mmap_region_t *next = mm + 1;
+
+		if (!mmap_regions_mergeable(ctx, mm, next)) {
+			++mm;
+			continue;
+		}
+
+		mm->size += next->size;
+		(void)memmove(next, next + 1U,
+			      (uintptr_t)mm_last - (uintptr_t)next);
+		merged++;
+	}
+
+	if (merged != 0U)
+		VERBOSE("Merged %u contiguous mmap regions\n", merged);
+}
+
+#endif /* XLAT_TABLES_MERGE_REGIONS */
+
 void __init init_xlat_tables_ctx(xlat_ctx_t *ctx)
 {
 	assert(ctx != NULL);
@@ -1201,6 +1445,10 @@ void __init init_xlat_tables_ctx(xlat_ctx_t *ctx)
 	assert(ctx->va_max_address <= (MAX_VIRT_ADDR_SPACE_SIZE - 1U));
 	assert(IS_POWER_OF_TWO(ctx->va_max_address + 1U));
 
+#if XLAT_TABLES_MERGE_REGIONS
+	mmap_merge_regions(ctx);
+#endif
+
 	xlat_mmap_print(mm);
 
 	/* All tables must be zeroed before mapping any region. */
@@ -22,6 +22,36 @@
 
 #include "xlat_tables_private.h"
 
+/* Returns the number of sub-tables in use in the context */
+static int xlat_tables_used(const xlat_ctx_t *ctx)
+{
+#if PLAT_XLAT_TABLES_DYNAMIC
+	int used = 0;
+
+	for (int i = 0; i < ctx->tables_num; ++i) {
+		if (ctx->tables_mapped_regions[i] != 0)
+			++used;
+	}
+
+	return used;
+#else
+	return ctx->next_table;
+#endif
+}
+
+void xlat_get_usage_ctx(const xlat_ctx_t *ctx, xlat_usage_t *usage)
+{
+	int regions = 0;
+
+	while ((regions < ctx->mmap_num) && (ctx->mmap[regions].size != 0U))
+		regions++;
+
+	usage->mmap_regions = regions;
+	usage->mmap_regions_max = ctx->mmap_num;
+	usage->tables = xlat_tables_used(ctx);
+	usage->tables_max = ctx->tables_num;
+}
+
 #if LOG_LEVEL < LOG_LEVEL_VERBOSE
 
 void xlat_mmap_print(__unused const mmap_region_t *mmap)
@@ -220,6 +250,63 @@ static void xlat_tables_print_internal(xlat_ctx_t *ctx, uintptr_t table_base_va,
 	}
 }
 
+/*
+ * Recursive function that counts the table and block/page descriptors of the
+ * translation tables passed as an argument, per lookup level.
+ */
+static void xlat_tables_count_desc(const uint64_t *table_base,
+		unsigned int table_entries, unsigned int level,
+		unsigned int *tables, unsigned int *blocks)
+{
+	assert(level <= XLAT_TABLE_LEVEL_MAX);
+
+	for (unsigned int table_idx = 0U; table_idx < table_entries;
+	     table_idx++) {
+		uint64_t desc = table_base[table_idx];
+
+		if ((desc & DESC_MASK) == INVALID_DESC)
+			continue;
+
+		if (((desc & DESC_MASK) == TABLE_DESC) &&
+				(level < XLAT_TABLE_LEVEL_MAX)) {
+			tables[level]++;
+			xlat_tables_count_desc(
+				(uint64_t *)(uintptr_t)(desc & TABLE_ADDR_MASK),
+				XLAT_TABLE_ENTRIES, level + 1U, tables, blocks);
+		} else {
+			blocks[level]++;
+		}
+	}
+}
+
+/*
+ * Print how the mapped regions are described: number of table descriptors and
+ * of block (or page, at level 3) descriptors per level. Each block or page
+ * descriptor needs its own TLB entry, so their sum is the number of TLB entries
+ * needed to cover everything that is mapped.
+ */
+static void xlat_tables_print_footprint(const xlat_ctx_t *ctx)
+{
+	unsigned int tables[XLAT_TABLE_LEVEL_MAX + 1U] = { 0U };
+	unsigned int blocks[XLAT_TABLE_LEVEL_MAX + 1U] = { 0U };
+	unsigned int tlb_entries = 0U;
+
+	xlat_tables_count_desc(ctx->base_table, ctx->base_table_entries,
+			       ctx->base_level, tables, blocks);
+
+	VERBOSE("  Descriptors per level:\n");
+	for (unsigned int level = ctx->base_level;
+	     level <= XLAT_TABLE_LEVEL_MAX; level++) {
+		VERBOSE("    LV%u: %u table, %u %s (0x%zx each)\n", level,
+			tables[level], blocks[level],
+			(level == XLAT_TABLE_LEVEL_MAX) ? "page" : "block",
+			(size_t)XLAT_BLOCK_SIZE(level));
+		tlb_entries += blocks[level];
+	}
+	VERBOSE("  Estimated TLB entries to cover all mappings: %u\n",
+		tlb_entries);
+}
+
 void xlat_tables_print(xlat_ctx_t *ctx)
 {
 	const char *xlat_regime_str;
@@ -244,19 +331,13 @@ void xlat_tables_print(xlat_ctx_t *ctx)
 	VERBOSE("  Entries @initial lookup level: %u\n",
 		ctx->base_table_entries);
 
-#if PLAT_XLAT_TABLES_DYNAMIC
-	used_page_tables = 0;
-	for (int i = 0; i < ctx->tables_num; ++i) {
-		if (ctx->tables_mapped_regions[i] != 0)
-			++used_page_tables;
-	}
-#else
-	used_page_tables = ctx->next_table;
-#endif
+	used_page_tables = xlat_tables_used(ctx);
 	VERBOSE("  Used %d sub-tables out of %d (spare: %d)\n",
 		used_page_tables, ctx->tables_num,
 		ctx->tables_num - used_page_tables);
 
+	xlat_tables_print_footprint(ctx);
+
 	xlat_tables_print_internal(ctx, 0U, ctx->base_table,
 				   ctx->base_table_entries, ctx->base_level);
 }
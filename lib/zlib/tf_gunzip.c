@@ -102,6 +102,21 @@ int gunzip(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf,
 	return ret;
 }
 
+#if ZLIB_HW_CRC32
+/*
+ * zlib's crc32(), implemented on top of tf_crc32() and the Armv8 CRC32
+ * instructions instead of the tables in crc32.c, which is not built.
+ */
+unsigned long ZEXPORT crc32(unsigned long crc, const unsigned char FAR *buf,
+			    uInt len)
+{
+	if (buf == Z_NULL) {
+		return 0UL;
+	}
+
+	return (unsigned long)tf_crc32((uint32_t)crc, buf, len);
+}
+#else
 /* Wrapper function to calculate CRC
  * @crc: previous accumulated CRC
  * @buf: buffer base address
@@ -113,3 +128,4 @@ uint32_t tf_crc32(uint32_t crc, const unsigned char *buf, size_t size)
 {
 	return (uint32_t)crc32((unsigned long)crc, buf, size);
 }
+#endif /* ZLIB_HW_CRC32 */
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Based on inffast.c from zlib 1.2.11, Copyright (C) 1995-2017 Mark Adler.
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "zutil.h"
+#include "inftrees.h"
+#include "inflate.h"
+#include "inffast.h"
+
+/*
+ * Drop-in replacement for inflate_fast() for 64-bit targets, where the bit
+ * accumulator 'hold' is 64-bit wide. It differs from the stock version in two
+ * ways:
+ *
+ * - The accumulator is refilled to at least 56 bits at the top of the loop
+ *   with a single 8-byte load, which is enough for any literal or
+ *   length/distance pair (at most 48 bits), instead of being topped up 8 or
+ *   16 bits at a time in up to four places per code.
+ *
+ * - Long matches are copied with memcpy() and memset() rather than one byte
+ *   at a time. Overlapping matches are copied in chunks which double in size,
+ *   each one a multiple of the distance, so that every chunk copy is free of
+ *   overlap.
+ *
+ * The 8-byte load is a memcpy(), which -mstrict-align turns into byte loads,
+ * and long copies go through the C library, so this is safe with alignment
+ * checking enabled and with the MMU off. Only little-endian targets are
+ * supported.
+ */
+
+#ifndef __LP64__
+#error "tf_inffast.c requires a 64-bit bit accumulator"
+#endif
+
+/* Below this length, a byte loop is faster than calling into the C library */
+#define MIN_LIB_COPY	16U
+
+/* Bits guaranteed in the accumulator after a refill */
+#define REFILL_BITS	56U
+
+static inline unsigned char FAR *copy_bytes(unsigned char FAR *out,
+					    const unsigned char FAR *from,
+					    unsigned int len)
+{
+	if (len >= MIN_LIB_COPY) {
+		(void)memcpy(out, from, len);
+		return out + len;
+	}
+
+	while (len-- != 0U) {
+		*out++ = *from++;
+	}
+
+	return out;
+}
+
+/* Copy a match from the output written so far, 'from' may overlap 'out' */
+static inline unsigned char FAR *copy_match(unsigned char FAR *out,
+					    unsigned int dist,
+					    unsigned int len)
+{
+	const unsigned char FAR *from = out - dist;
+	unsigned int chunk;
+
+	if ((dist >= len) || (len < MIN_LIB_COPY)) {
+		if (dist >= len) {
+			return copy_bytes(out, from, len);
+		}
+
+		while (len-- != 0U) {
+			*out++ = *from++;
+		}
+
+		return out;
+	}
+
+	if (dist == 1U) {
+		(void)memset(out, out[-1], len);
+		return out + len;
+	}
+
+	/*
+	 * The bytes from 'from' to 'out' repeat with a period of 'dist', and
+	 * after each copy below 'out - from' is still a multiple of 'dist'.
+	 */
+	while (len != 0U) {
+		chunk = (unsigned int)(out - from);
+		if (chunk > len) {
+			chunk = len;
+		}
+		(void)memcpy(out, from, chunk);
+		out += chunk;
+		len -= chunk;
+	}
+
+	return out;
+}
+
+/*
+ * Decode literal, length, and distance codes and write out the resulting
+ * literal and match bytes until either not enough input or output is
+ * available, an end-of-block is encountered, or a data error is encountered.
+ * The entry assumptions and exit states are the same as for the stock
+ * inflate_fast() in inffast.c.
+ */
+void ZLIB_INTERNAL inflate_fast(z_streamp strm, unsigned start)
+{
+	struct inflate_state FAR *state;
+	z_const unsigned char FAR *in;		/* local strm->next_in */
+	z_const unsigned char FAR *in_end;	/* end of input */
+	z_const unsigned char FAR *last;	/* can refill word-wise while in < last */
+	unsigned char FAR *out;			/* local strm->next_out */
+	unsigned char FAR *beg;			/* inflate()'s initial strm->next_out */
+	unsigned char FAR *end;			/* while out < end, enough space available */
+#ifdef INFLATE_STRICT
+	unsigned int dmax;			/* maximum distance from zlib header */
+#endif
+	unsigned int wsize;			/* window size or zero if not using window */
+	unsigned int whave;			/* valid bytes in the window */
+	unsigned int wnext;			/* window write index */
+	unsigned char FAR *window;		/* allocated sliding window, if wsize != 0 */
+	uint64_t hold;				/* local strm->hold */
+	uint64_t word;				/* next 8 bytes of input */
+	unsigned int bits;			/* local strm->bits */
+	code const FAR *lcode;			/* local strm->lencode */
+	code const FAR *dcode;			/* local strm->distcode */
+	unsigned int lmask;			/* mask for first level of length codes */
+	unsigned int dmask;			/* mask for first level of distance codes */
+	code const *here;			/* retrieved table entry */
+	unsigned int op;			/* code bits, operation, extra bits, or */
+						/*  window position, window bytes to copy */
+	unsigned int len;			/* match length, unused bytes */
+	unsigned int dist;			/* match distance */
+	unsigned char FAR *from;		/* where to copy match from */
+
+	/* copy state to local variables */
+	state = (struct inflate_state FAR *)strm->state;
+	in = strm->next_in;
+	in_end = in + strm->avail_in;
+	last = in_end - 8;
+	out = strm->next_out;
+	beg = out - (start - strm->avail_out);
+	end = out + (strm->avail_out - 257);
+#ifdef INFLATE_STRICT
+	dmax = state->dmax;
+#endif
+	wsize = state->wsize;
+	whave = state->whave;
+	wnext = state->wnext;
+	window = state->window;
+	hold = state->hold;
+	bits = state->bits;
+	lcode = state->lencode;
+	dcode = state->distcode;
+	lmask = (1U << state->lenbits) - 1;
+	dmask = (1U << state->distbits) - 1;
+
+	/*
+	 * inflate() only guarantees 6 bytes of input on entry, which is enough
+	 * for the first code. The refill below needs 8, so top up a byte at a
+	 * time the first time round if the input is that short.
+	 */
+	if (in > last) {
+		while ((bits < 48U) && (in < in_end)) {
+			hold |= (uint64_t)(*in++) << bits;
+			bits += 8U;
+		}
+	}
+
+	/* decode literals and length/distances until end-of-block or not enough
+	   input data or output space */
+	do {
+		if ((bits < 48U) && (in <= last)) {
+			/*
+			 * Load 8 bytes but only account for the whole ones
+			 * which fit. The bits of the next byte which did fit
+			 * are OR'ed in again, unchanged, by the next refill.
+			 */
+			(void)memcpy(&word, in, sizeof(word));
+			hold |= word << bits;
+			in += (63U - bits) >> 3;
+			bits |= REFILL_BITS;
+		}
+		here = lcode + (hold & lmask);
+	dolen:
+		op = (unsigned int)(here->bits);
+		hold >>= op;
+		bits -= op;
+		op = (unsigned int)(here->op);
+		if (op == 0U) {				/* literal */
+			*out++ = (unsigned char)(here->val);
+		} else if ((op & 16U) != 0U) {		/* length base */
+			len = (unsigned int)(here->val);
+			op &= 15U;			/* number of extra bits */
+			len += (unsigned int)hold & ((1U << op) - 1U);
+			hold >>= op;
+			bits -= op;
+			here = dcode + (hold & dmask);
+		dodist:
+			op = (unsigned int)(here->bits);
+			hold >>= op;
+			bits -= op;
+			op = (unsigned int)(here->op);
+			if ((op & 16U) != 0U) {		/* distance base */
+				dist = (unsigned int)(here->val);
+				op &= 15U;		/* number of extra bits */
+				dist += (unsigned int)hold & ((1U << op) - 1U);
+#ifdef INFLATE_STRICT
+				if (dist > dmax) {
+					strm->msg = (char *)"invalid distance too far back";
+					state->mode = BAD;
+					break;
+				}
+#endif
+				hold >>= op;
+				bits -= op;
+				op = (unsigned int)(out - beg);	/* max distance in output */
+				if (dist <= op) {	/* copy direct from output */
+					out = copy_match(out, dist, len);
+					continue;
+				}
+
+				/* copy from window */
+				op = dist - op;		/* distance back in window */
+				if (op > whave) {
+					strm->msg = (char *)"invalid distance too far back";
+					state->mode = BAD;
+					break;
+				}
+				from = window;
+				if (wnext == 0U) {	/* very common case */
+					from += wsize - op;
+				} else if (wnext < op) {	/* wrap around window */
+					from += wsize + wnext - op;
+					op -= wnext;
+					if (op < len) {	/* some from end of window */
+						len -= op;
+						out = copy_bytes(out, from, op);
+						from = window;
+						op = wnext;
+					}
+				} else {		/* contiguous in window */
+					from += wnext - op;
+				}
+				if (op < len) {		/* some from window */
+					len -= op;
+					out = copy_bytes(out, from, op);
+					out = copy_match(out, dist, len);
+				} else {
+					out = copy_bytes(out, from, len);
+				}
+			} else if ((op & 64U) == 0U) {	/* 2nd level distance code */
+				here = dcode + here->val + (hold & ((1U << op) - 1U));
+				goto dodist;
+			} else {
+				strm->msg = (char *)"invalid distance code";
+				state->mode = BAD;
+				break;
+			}
+		} else if ((op & 64U) == 0U) {		/* 2nd level length code */
+			here = lcode + here->val + (hold & ((1U << op) - 1U));
+			goto dolen;
+		} else if ((op & 32U) != 0U) {		/* end-of-block */
+			state->mode = TYPE;
+			break;
+		} else {
+			strm->msg = (char *)"invalid literal/length code";
+			state->mode = BAD;
+			break;
+		}
+	} while ((in <= last) && (out < end));
+
+	/* return unused bytes */
+	len = bits >> 3;
+	in -= len;
+	bits -= len << 3;
+	hold &= (1U << bits) - 1U;
+
+	/* update state and return */
+	strm->next_in = in;
+	strm->next_out = out;
+	strm->avail_in = (unsigned int)(in_end - in);
+	strm->avail_out = (unsigned int)(out < end ?
+					 257 + (end - out) : 257 - (out - end));
+	state->hold = hold;
+	state->bits = bits;
+}
@@ -19,6 +19,38 @@ ZLIB_SOURCES	:=	$(addprefix $(ZLIB_PATH)/,	\
 ZLIB_SOURCES	+=	$(addprefix $(ZLIB_PATH)/,	\
 					tf_gunzip.c)
 
+# On AArch64, replace the inner inflate loop with one that makes use of the
+# 64-bit bit accumulator
+ifeq (${ARCH},aarch64)
+ZLIB_SOURCES	:=	$(filter-out $(ZLIB_PATH)/inffast.c,$(ZLIB_SOURCES))
+ZLIB_SOURCES	+=	$(ZLIB_PATH)/tf_inffast.c
+endif
+
+# Compute the gzip CRC32 with the Armv8 CRC32 instructions in tf_crc32.c
+# rather than with the large tables of crc32.c
+ZLIB_HW_CRC32	?=	0
+$(eval $(call assert_boolean,ZLIB_HW_CRC32))
+$(eval $(call add_define,ZLIB_HW_CRC32))
+
+ifeq (${ZLIB_HW_CRC32},1)
+ifneq (${ARCH},aarch64)
+        $(error "ZLIB_HW_CRC32 is only supported on AArch64")
+endif
+ZLIB_SOURCES	:=	$(filter-out $(ZLIB_PATH)/crc32.c,$(ZLIB_SOURCES))
+ZLIB_SOURCES	+=	common/tf_crc32.c
+
+# CRC32 instructions are optional in Armv8.0 and mandatory from Armv8.1. Add
+# the "crc" feature modifier to the -march derived from ARM_ARCH_MAJOR/MINOR
+# rather than overriding it.
+ifeq (${ARM_ARCH_MAJOR},8)
+    ifeq (${ARM_ARCH_MINOR},0)
+        ifeq ( ,$(findstring crc,$(arch-features)))
+            arch-features	:=	$(arch-features)+crc
+        endif	# crc
+    endif
+endif
+endif
+
 INCLUDES	+=	-Iinclude/lib/zlib
 
 # REVISIT: the following flags need not be given globally
@@ -185,6 +185,10 @@ endif
 # Option to build TF with Measured Boot support
 MEASURED_BOOT			:= 0
 
+# Option to hash images while they are loaded and reuse the digest for both
+# authentication and measurement
+IMAGE_HASH_ON_LOAD		:= 0
+
 # Option to enable the DICE Protection Environmnet as a Measured Boot backend
 DICE_PROTECTION_ENVIRONMENT	:=0
 
@@ -207,6 +211,9 @@ PSCI_EXTENDED_STATE_ID		:= 0
 # Enable PSCI OS-initiated mode support
 PSCI_OS_INIT_MODE		:= 0
 
+# Keep residency histograms and entry/exit latencies along with PSCI_STAT
+PSCI_STAT_HISTOGRAM		:= 0
+
 # By default, BL1 acts as the reset handler, not BL31
 RESET_TO_BL31			:= 0
 
@@ -228,6 +235,9 @@ ERRATA_NON_ARM_INTERCONNECT	:= 0
 # SMCCC PCI support
 SMC_PCI_SUPPORT			:= 0
 
+# Dispatch registered leaf SMCs without a full EL3 context save/restore
+SMC_LEAF_FASTPATH		:= 0
+
 # Whether code and read-only data should be put on separate memory pages. The
 # platform Makefile is free to override this value.
 SEPARATE_CODE_AND_RODATA	:= 0
@@ -311,6 +321,11 @@ USE_TBBR_DEFS			:= 1
 # platforms).
 WARMBOOT_ENABLE_DCACHE_EARLY	:= 0
 
+# Whether to merge contiguous static mmap regions with the same attributes when
+# initializing the translation tables, so that block descriptors can be used
+# wherever the merged regions allow it.
+XLAT_TABLES_MERGE_REGIONS	:= 0
+
 # Default SVE vector length to maximum architected value
 SVE_VECTOR_LEN			:= 2048
 
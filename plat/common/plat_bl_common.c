@@ -5,10 +5,12 @@
  */
 
 #include <assert.h>
+#include <errno.h>
 
 #include <arch_helpers.h>
 #include <common/bl_common.h>
 #include <common/debug.h>
+#include <drivers/auth/crypto_mod.h>
 #include <lib/xlat_tables/xlat_tables_compat.h>
 #include <plat/common/platform.h>
 #include <services/arm_arch_svc.h>
@@ -28,6 +30,13 @@
 #pragma weak plat_is_smccc_feature_available
 #pragma weak plat_get_soc_version
 #pragma weak plat_get_soc_revision
+#if IMAGE_HASH_ON_LOAD
+#pragma weak plat_image_hash_update
+#pragma weak plat_image_hash_wait
+#endif
+#if TRUSTED_BOARD_BOOT
+#pragma weak plat_defer_image_auth
+#endif
 
 int32_t plat_get_soc_version(void)
 {
@@ -58,6 +67,36 @@ void bl2_plat_preload_setup(void)
 {
 }
 
+#if IMAGE_HASH_ON_LOAD
+/*
+ * Hash the next chunk of the image being loaded. Platforms may override this
+ * to hash the chunk asynchronously, e.g. on another core, in which case the
+ * chunk must not be modified until plat_image_hash_wait() has returned.
+ */
+int plat_image_hash_update(void *data_ptr, unsigned int data_len)
+{
+	return crypto_mod_image_hash_update(data_ptr, data_len);
+}
+
+/* Wait for the chunks passed to plat_image_hash_update() to be hashed */
+int plat_image_hash_wait(void)
+{
+	return 0;
+}
+#endif /* IMAGE_HASH_ON_LOAD */
+
+#if TRUSTED_BOARD_BOOT
+/*
+ * Platforms may override this to take over the authentication of an image
+ * which is not needed until a later boot stage. By default, images are
+ * authenticated as soon as they have been loaded.
+ */
+int plat_defer_image_auth(unsigned int image_id, image_info_t *image_data)
+{
+	return -ENOTSUP;
+}
+#endif /* TRUSTED_BOARD_BOOT */
+
 int bl2_plat_handle_pre_image_load(unsigned int image_id)
 {
 	return 0;
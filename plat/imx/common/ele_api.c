@@ -10,6 +10,7 @@
 
 #include <platform_def.h>
 #include <ele_api.h>
+#include <imx_telemetry.h>
 
 #define ELE_MU_RSR	(ELE_MU_BASE + 0x12c)
 #define ELE_MU_TRx(i)	(ELE_MU_BASE + 0x200 + (i) * 4)
@@ -27,9 +28,11 @@ int imx9_soc_info_handler(uint32_t smc_fid, void *handle)
 void ele_get_soc_info(void)
 {
 	uint32_t msg, resp;
+	uint64_t start;
 
 	flush_dcache_range((uint64_t)&soc_info, sizeof(struct ele_soc_info));
 
+	start = imx_telem_now();
 	mmio_write_32(ELE_MU_TRx(0), ELE_GET_INFO_REQ);
 	mmio_write_32(ELE_MU_TRx(1), ((uint64_t) &soc_info) >> 32);
 	mmio_write_32(ELE_MU_TRx(2), ((uint64_t) &soc_info) & 0xffffffff);
@@ -41,6 +44,7 @@ void ele_get_soc_info(void)
 
 	msg = mmio_read_32(ELE_MU_RRx(0));
 	resp = mmio_read_32(ELE_MU_RRx(1));
+	imx_telem_mbox_call(start);
 	VERBOSE("msg : %x, resp: %x\n", msg, resp);
 }
 
@@ -48,7 +52,9 @@ void ele_get_soc_info(void)
 void ele_release_gmid(void)
 {
 	uint32_t msg, resp;
+	uint64_t start;
 
+	start = imx_telem_now();
 	mmio_write_32(ELE_MU_TRx(0), ELE_RELEASE_GMID);
 
 	do {
@@ -57,6 +63,7 @@ void ele_release_gmid(void)
 
 	msg = mmio_read_32(ELE_MU_RRx(0));
 	resp = mmio_read_32(ELE_MU_RRx(1));
+	imx_telem_mbox_call(start);
 	NOTICE("msg : %x, resp: %x\n", msg, resp);
 }
 
@@ -65,7 +72,9 @@ void ele_release_gmid(void)
 static int ele_get_trng_state(void)
 {
 	uint32_t msg, resp, state;
+	uint64_t start;
 
+	start = imx_telem_now();
 	mmio_write_32(ELE_MU_TRx(0), ELE_GET_TRNG_STATE);
 
 	do {
@@ -75,6 +84,7 @@ static int ele_get_trng_state(void)
 	msg = mmio_read_32(ELE_MU_RRx(0));
 	resp = mmio_read_32(ELE_MU_RRx(1));
 	state = mmio_read_32(ELE_MU_RRx(2));
+	imx_telem_mbox_call(start);
 	VERBOSE("msg : %x, resp: %x\n", msg, resp);
 
 	if (resp != 0xd6 ||
@@ -91,6 +101,7 @@ int ele_get_trng(void* addr, uint32_t len)
 	/* Natural Alignment to 64 Bit */
 	uint64_t buffer[ELE_TRNG_MAX_SIZE/(sizeof(uint64_t))] = {0};
 	uint8_t* current_pos = addr;
+	uint64_t start;
 
 	if (addr == NULL || len == 0) {
 		return -1;
@@ -105,6 +116,7 @@ int ele_get_trng(void* addr, uint32_t len)
 	do {
 		flush_dcache_range((uint64_t)buffer, ELE_TRNG_MAX_SIZE);
 
+		start = imx_telem_now();
 		mmio_write_32(ELE_MU_TRx(0), ELE_GET_RNG);
 		mmio_write_32(ELE_MU_TRx(1), 0x2);
 		mmio_write_32(ELE_MU_TRx(2), ((uint64_t)buffer) & 0xffffffff);
@@ -116,6 +128,7 @@ int ele_get_trng(void* addr, uint32_t len)
 
 		msg = mmio_read_32(ELE_MU_RRx(0));
 		resp = mmio_read_32(ELE_MU_RRx(1));
+		imx_telem_mbox_call(start);
 		VERBOSE("msg : %x, resp: %x\n", msg, resp);
 
 		if (resp != 0xd6)
@@ -153,9 +166,11 @@ int ele_program_bbsm(uint8_t operation, uint16_t policy_mask, uint32_t reg_offse
 {
 	int ret = 0;
 	uint32_t msg_op_policy, rsr_status, resp_hdr, resp_code, resp_reg_value;
+	uint64_t start;
 
 	msg_op_policy = (policy_mask << 16) | operation;
 
+	start = imx_telem_now();
 	mmio_write_32(ELE_RT_MU_TRx(0), ELE_PROGRAM_BBSM_REQ);
 	mmio_write_32(ELE_RT_MU_TRx(1), msg_op_policy);
 	mmio_write_32(ELE_RT_MU_TRx(2), reg_offset);
@@ -168,6 +183,7 @@ int ele_program_bbsm(uint8_t operation, uint16_t policy_mask, uint32_t reg_offse
 	resp_hdr = mmio_read_32(ELE_RT_MU_RRx(0));
 	resp_code = mmio_read_32(ELE_RT_MU_RRx(1));
 	resp_reg_value = mmio_read_32(ELE_RT_MU_RRx(2));
+	imx_telem_mbox_call(start);
 
 	VERBOSE("resp_hdr: %x, resp_code: %x, resp_reg_value %x\n",
 		resp_hdr, resp_code, resp_reg_value);
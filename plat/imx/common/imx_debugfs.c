@@ -0,0 +1,152 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+
+#include <lib/debugfs.h>
+#include <lib/utils_def.h>
+
+#include <imx_telemetry.h>
+#include <imx_ticks.h>
+#include <platform_def.h>
+
+/* Power up and down, suspend and resume of each core */
+static void imx_debugfs_psci(debugfs_text_t *text)
+{
+	const uint64_t *block;
+	unsigned int core;
+
+	debugfs_text_printf(text,
+		"core on off suspend resume suspend_us entry_us exit_us\n");
+
+	for (core = 0U; core < PLATFORM_CORE_COUNT; core++) {
+		block = imx_telem_block(core);
+		if (block == NULL) {
+			return;
+		}
+
+		debugfs_text_printf(text,
+			"%u %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64
+			" %llu %llu %llu\n",
+			core, block[IMX_TELEM_PSCI_CPU_ON],
+			block[IMX_TELEM_PSCI_CPU_OFF],
+			block[IMX_TELEM_PSCI_SUSPEND],
+			block[IMX_TELEM_PSCI_RESUME],
+			imx_ticks_to_us(block[IMX_TELEM_PSCI_SUSPEND_TICKS]),
+			imx_ticks_to_us(block[IMX_TELEM_PSCI_ENTRY_TICKS]),
+			imx_ticks_to_us(block[IMX_TELEM_PSCI_EXIT_TICKS]));
+	}
+}
+
+/* Time each core took to come up through CPU_ON, in stages */
+static void imx_debugfs_cpu_on(debugfs_text_t *text)
+{
+	uint64_t failed = 0U;
+	const uint64_t *block;
+	unsigned int core;
+
+	for (core = 0U; core < PLATFORM_CORE_COUNT; core++) {
+		block = imx_telem_block(core);
+		if (block == NULL) {
+			return;
+		}
+
+		failed += block[IMX_TELEM_CPU_ON_FAILS];
+	}
+
+	debugfs_text_printf(text, "failed %" PRIu64 "\n", failed);
+	debugfs_text_printf(text, "core on power_us boot_us total_us max_us\n");
+
+	for (core = 0U; core < PLATFORM_CORE_COUNT; core++) {
+		block = imx_telem_block(core);
+
+		debugfs_text_printf(text,
+			"%u %" PRIu64 " %llu %llu %llu %llu\n",
+			core, block[IMX_TELEM_PSCI_CPU_ON],
+			imx_ticks_to_us(block[IMX_TELEM_CPU_ON_PWR_TICKS]),
+			imx_ticks_to_us(block[IMX_TELEM_CPU_ON_BOOT_TICKS]),
+			imx_ticks_to_us(block[IMX_TELEM_CPU_ON_TICKS]),
+			imx_ticks_to_us(block[IMX_TELEM_CPU_ON_MAX_TICKS]));
+	}
+}
+
+/* Histogram of the SCU or ELE round trips of all the cores */
+static void imx_debugfs_mbox(debugfs_text_t *text)
+{
+	uint64_t calls = 0U, ticks = 0U, max_ticks = 0U;
+	const uint64_t *block;
+	unsigned int i;
+
+	for (i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		block = imx_telem_block(i);
+		if (block == NULL) {
+			return;
+		}
+
+		calls += block[IMX_TELEM_MBOX_CALLS];
+		ticks += block[IMX_TELEM_MBOX_TICKS];
+		max_ticks = MAX(max_ticks, block[IMX_TELEM_MBOX_MAX_TICKS]);
+	}
+
+	debugfs_text_printf(text, "calls %" PRIu64
+			    " total_us %llu max_us %llu\n",
+			    calls, imx_ticks_to_us(ticks),
+			    imx_ticks_to_us(max_ticks));
+
+	debugfs_text_printf(text, "below_us calls\n");
+	for (i = 0U; i < (IMX_TELEM_MBOX_BUCKETS - 1U); i++) {
+		debugfs_text_printf(text, "%u %u\n", 1U << i,
+				    imx_telem_mbox_bucket(i));
+	}
+	debugfs_text_printf(text, "- %u\n", imx_telem_mbox_bucket(i));
+}
+
+/* Latest DDR frequency switches, the oldest first */
+static void imx_debugfs_dvfs(debugfs_text_t *text)
+{
+	struct imx_telem_dvfs_switch hist[IMX_TELEM_DVFS_HISTORY];
+	uint64_t switches = 0U, wait_ticks = 0U;
+	const uint64_t *block;
+	unsigned int i, count;
+
+	for (i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		block = imx_telem_block(i);
+		if (block == NULL) {
+			return;
+		}
+
+		switches += block[IMX_TELEM_DVFS_SWITCHES];
+		wait_ticks += block[IMX_TELEM_DVFS_WAIT_TICKS];
+	}
+
+	debugfs_text_printf(text, "switches %" PRIu64 " parked_us %llu\n",
+			    switches, imx_ticks_to_us(wait_ticks));
+
+	count = imx_telem_dvfs_history(hist);
+
+	debugfs_text_printf(text, "at_us from_mts to_mts switch_us\n");
+	for (i = 0U; i < count; i++) {
+		debugfs_text_printf(text, "%llu %u %u %llu\n",
+				    imx_ticks_to_us(hist[i].start),
+				    hist[i].from_mts, hist[i].to_mts,
+				    imx_ticks_to_us(hist[i].ticks));
+	}
+}
+
+static const debugfs_stats_file_t imx_stats_files[] = {
+	{"psci", imx_debugfs_psci},
+	{"cpu_on", imx_debugfs_cpu_on},
+	{"mbox", imx_debugfs_mbox},
+	{"dvfs", imx_debugfs_dvfs},
+};
+
+const debugfs_stats_file_t *plat_debugfs_stats_files(unsigned int *count)
+{
+	*count = ARRAY_SIZE(imx_stats_files);
+
+	return imx_stats_files;
+}
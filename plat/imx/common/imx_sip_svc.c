@@ -13,6 +13,7 @@
 #include <tools_share/uuid.h>
 
 #include <imx_sip_svc.h>
+#include <imx_telemetry.h>
 
 #include <ele_api.h>
 
@@ -30,6 +31,8 @@ static uintptr_t imx_sip_handler(unsigned int smc_fid,
 			void *handle,
 			u_register_t flags)
 {
+	imx_telem_sip_call(smc_fid);
+
 	switch (smc_fid) {
 	case IMX_SIP_AARCH32:
 		SMC_RET1(handle, imx_kernel_entry_handler(smc_fid, x1, x2, x3, x4));
@@ -134,6 +137,37 @@ static uintptr_t imx_sip_handler(unsigned int smc_fid,
 	}
 }
 
+#if SMC_LEAF_FASTPATH
+/*
+ * SiP queries that only return a constant or a cached value are registered as
+ * leaf SMCs, so BL31 answers them without saving the full caller context.
+ */
+static u_register_t imx_buildinfo_leaf(u_register_t x1, u_register_t x2,
+				       u_register_t x3, u_register_t x4)
+{
+	imx_telem_sip_call(IMX_SIP_BUILDINFO);
+
+	return imx_buildinfo_handler(IMX_SIP_BUILDINFO, x1, x2, x3, x4);
+}
+
+DECLARE_RT_SVC_LEAF(imx_sip_buildinfo, IMX_SIP_BUILDINFO, 0U, 0U,
+		    imx_buildinfo_leaf);
+
+#if defined(PLAT_imx8mq)
+static u_register_t imx_soc_info_leaf(u_register_t x1, u_register_t x2,
+				      u_register_t x3, u_register_t x4)
+{
+	imx_telem_sip_call(IMX_SIP_GET_SOC_INFO);
+
+	return (u_register_t)imx_soc_info_handler(IMX_SIP_GET_SOC_INFO,
+						  x1, x2, x3);
+}
+
+DECLARE_RT_SVC_LEAF(imx_sip_soc_info, IMX_SIP_GET_SOC_INFO, 0U, 0U,
+		    imx_soc_info_leaf);
+#endif
+#endif /* SMC_LEAF_FASTPATH */
+
 /* Define a runtime service descriptor for fast SMC calls */
 DECLARE_RT_SVC(
 		imx_sip_svc,
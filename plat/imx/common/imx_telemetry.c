@@ -0,0 +1,313 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <lib/cassert.h>
+#include <lib/utils.h>
+#include <plat/common/platform.h>
+
+#include <imx_telemetry.h>
+#include <imx_ticks.h>
+#include <platform_def.h>
+
+#define IMX_TELEM_BLOCK_SIZE	(IMX_TELEM_COUNTERS * sizeof(uint64_t))
+
+CASSERT(sizeof(struct imx_telem_hdr) == 64U, assert_imx_telem_hdr_size);
+CASSERT((IMX_TELEM_BLOCK_SIZE % CACHE_WRITEBACK_GRANULE) == 0U,
+	assert_imx_telem_block_size);
+#if IMX_TELEMETRY
+CASSERT((sizeof(struct imx_telem_hdr) +
+	 (PLATFORM_CORE_COUNT * IMX_TELEM_BLOCK_SIZE)) <= IMX_TELEMETRY_SIZE,
+	assert_imx_telem_region_size);
+#else
+/* Only read through debugfs without the telemetry region */
+static uint64_t telem_counters[PLATFORM_CORE_COUNT * IMX_TELEM_COUNTERS]
+	__aligned(CACHE_WRITEBACK_GRANULE);
+#endif
+
+/* NULL until the counters are set up, so nothing is counted before then */
+static uint64_t *telem_blocks;
+
+/* When each core entered suspend, in the secure world only */
+static uint64_t suspend_since[PLATFORM_CORE_COUNT];
+
+/* Written by the core powering each core up, read by the latter once up */
+static uint64_t cpu_on_request[PLATFORM_CORE_COUNT];
+static uint64_t cpu_on_release[PLATFORM_CORE_COUNT];
+
+#if USE_DEBUGFS
+static uint32_t mbox_hist[PLATFORM_CORE_COUNT][IMX_TELEM_MBOX_BUCKETS];
+
+/* Written by the core switching, which the others wait for */
+static struct imx_telem_dvfs_switch dvfs_hist[IMX_TELEM_DVFS_HISTORY];
+static unsigned int dvfs_hist_count;
+
+static void imx_telem_mbox_record(uint64_t ticks)
+{
+	uint64_t us = imx_ticks_to_us(ticks);
+	unsigned int bucket;
+
+	for (bucket = 0U; (us != 0U) && (bucket < (IMX_TELEM_MBOX_BUCKETS - 1U));
+	     bucket++) {
+		us >>= 1;
+	}
+
+	mbox_hist[plat_my_core_pos()][bucket]++;
+}
+
+static void imx_telem_dvfs_record(unsigned int from_mts, unsigned int to_mts,
+				  uint64_t start, uint64_t ticks)
+{
+	struct imx_telem_dvfs_switch *sw =
+		&dvfs_hist[dvfs_hist_count % IMX_TELEM_DVFS_HISTORY];
+
+	sw->start = start;
+	sw->ticks = ticks;
+	sw->from_mts = from_mts;
+	sw->to_mts = to_mts;
+	dvfs_hist_count++;
+}
+
+/* Mailbox round trips of all the cores which took as long as 'bucket' */
+uint32_t imx_telem_mbox_bucket(unsigned int bucket)
+{
+	uint32_t calls = 0U;
+	unsigned int core;
+
+	for (core = 0U; core < PLATFORM_CORE_COUNT; core++) {
+		calls += mbox_hist[core][bucket];
+	}
+
+	return calls;
+}
+
+/*
+ * Copy the latest DDR frequency switches, up to IMX_TELEM_DVFS_HISTORY of them
+ * and the oldest first, to 'hist' and return how many there are.
+ */
+unsigned int imx_telem_dvfs_history(struct imx_telem_dvfs_switch *hist)
+{
+	unsigned int count = dvfs_hist_count;
+	unsigned int first = 0U;
+	unsigned int i;
+
+	if (count > IMX_TELEM_DVFS_HISTORY) {
+		first = count - IMX_TELEM_DVFS_HISTORY;
+	}
+
+	for (i = first; i < count; i++) {
+		hist[i - first] = dvfs_hist[i % IMX_TELEM_DVFS_HISTORY];
+	}
+
+	return count - first;
+}
+#endif
+
+uint64_t *imx_telem_block(unsigned int core)
+{
+	if ((telem_blocks == NULL) || (core >= PLATFORM_CORE_COUNT)) {
+		return NULL;
+	}
+
+	return &telem_blocks[core * IMX_TELEM_COUNTERS];
+}
+
+uint64_t *imx_telem_my_block(void)
+{
+	return imx_telem_block(plat_my_core_pos());
+}
+
+void imx_telem_sip_call(uint32_t smc_fid)
+{
+	unsigned int slot = smc_fid & 0xffffU;
+
+	if (((smc_fid & 0xffff0000U) != 0xc2000000U) ||
+	    (slot >= IMX_TELEM_SIP_SLOTS)) {
+		slot = IMX_TELEM_SIP_SLOTS - 1U;
+	}
+
+	imx_telem_inc(IMX_TELEM_SIP_CALLS + slot);
+}
+
+void imx_telem_add_time(unsigned int counter, uint64_t start)
+{
+	uint64_t *block = imx_telem_my_block();
+
+	if (block != NULL) {
+		block[counter] += read_cntpct_el0() - start;
+	}
+}
+
+void imx_telem_mbox_call(uint64_t start)
+{
+	uint64_t *block = imx_telem_my_block();
+	uint64_t ticks = read_cntpct_el0() - start;
+
+	if (block == NULL) {
+		return;
+	}
+
+	block[IMX_TELEM_MBOX_CALLS]++;
+	block[IMX_TELEM_MBOX_TICKS] += ticks;
+	if (ticks > block[IMX_TELEM_MBOX_MAX_TICKS]) {
+		block[IMX_TELEM_MBOX_MAX_TICKS] = ticks;
+	}
+
+#if USE_DEBUGFS
+	imx_telem_mbox_record(ticks);
+#endif
+}
+
+/* Called at the end of the platform suspend hook, which started at 'start' */
+void imx_telem_suspend_enter(uint64_t start)
+{
+	uint64_t *block = imx_telem_my_block();
+	uint64_t now = read_cntpct_el0();
+
+	if (block == NULL) {
+		return;
+	}
+
+	block[IMX_TELEM_PSCI_SUSPEND]++;
+	block[IMX_TELEM_PSCI_ENTRY_TICKS] += now - start;
+	suspend_since[plat_my_core_pos()] = now;
+}
+
+/* Called at the end of the platform suspend finish hook */
+void imx_telem_suspend_exit(uint64_t start)
+{
+	uint64_t *block = imx_telem_my_block();
+	uint64_t since = suspend_since[plat_my_core_pos()];
+
+	if (block == NULL) {
+		return;
+	}
+
+	block[IMX_TELEM_PSCI_RESUME]++;
+	block[IMX_TELEM_PSCI_EXIT_TICKS] += read_cntpct_el0() - start;
+	if (since != 0U) {
+		block[IMX_TELEM_PSCI_SUSPEND_TICKS] += start - since;
+	}
+}
+
+void imx_telem_lock_acquired(uint64_t start, bool contended)
+{
+	uint64_t *block = imx_telem_my_block();
+
+	if (block == NULL) {
+		return;
+	}
+
+	block[IMX_TELEM_LOCK_ACQUIRES]++;
+	if (contended) {
+		block[IMX_TELEM_LOCK_CONTENDED]++;
+		block[IMX_TELEM_LOCK_WAIT_TICKS] += read_cntpct_el0() - start;
+	}
+}
+
+/* Called by the core which switched the DDR frequency, once it is done */
+void imx_telem_dvfs_switch(unsigned int from_mts, unsigned int to_mts,
+			   uint64_t start)
+{
+	uint64_t *block = imx_telem_my_block();
+	uint64_t ticks = read_cntpct_el0() - start;
+
+	if (block == NULL) {
+		return;
+	}
+
+	block[IMX_TELEM_DVFS_SWITCHES]++;
+	block[IMX_TELEM_DVFS_SWITCH_TICKS] += ticks;
+
+#if USE_DEBUGFS
+	imx_telem_dvfs_record(from_mts, to_mts, start, ticks);
+#endif
+}
+
+/* Called when CPU_ON of 'core' starts */
+void imx_telem_cpu_on_request(unsigned int core)
+{
+	cpu_on_request[core] = read_cntpct_el0();
+	cpu_on_release[core] = 0U;
+}
+
+/* Called right before 'core', powered up, is let out of reset */
+void imx_telem_cpu_on_release(unsigned int core)
+{
+	cpu_on_release[core] = read_cntpct_el0();
+
+	/* Seen by the core before it gets out of reset */
+	dsb();
+}
+
+/* Called at the end of the platform power on finish hook */
+void imx_telem_cpu_on_done(uint64_t start)
+{
+	unsigned int core = plat_my_core_pos();
+	uint64_t *block = imx_telem_my_block();
+	uint64_t request = cpu_on_request[core];
+	uint64_t release = cpu_on_release[core];
+	uint64_t ticks;
+
+	if (block == NULL) {
+		return;
+	}
+
+	block[IMX_TELEM_PSCI_CPU_ON]++;
+
+	/* Only the cores powered up by imx_set_cpu_pwr_on() are timed */
+	if ((request == 0U) || (release == 0U)) {
+		return;
+	}
+
+	cpu_on_request[core] = 0U;
+	cpu_on_release[core] = 0U;
+
+	ticks = read_cntpct_el0() - request;
+	block[IMX_TELEM_CPU_ON_PWR_TICKS] += release - request;
+	block[IMX_TELEM_CPU_ON_BOOT_TICKS] += start - release;
+	block[IMX_TELEM_CPU_ON_TICKS] += ticks;
+	if (ticks > block[IMX_TELEM_CPU_ON_MAX_TICKS]) {
+		block[IMX_TELEM_CPU_ON_MAX_TICKS] = ticks;
+	}
+}
+
+#if IMX_TELEMETRY
+/*
+ * Set up the region at IMX_TELEMETRY_BASE, which must be mapped as non-secure
+ * memory and kept from the normal world's allocator, e.g. as a no-map
+ * reserved-memory node.
+ */
+void imx_telem_init(void)
+{
+	struct imx_telem_hdr *hdr = (struct imx_telem_hdr *)IMX_TELEMETRY_BASE;
+
+	zeromem(hdr, IMX_TELEMETRY_SIZE);
+
+	hdr->version = IMX_TELEM_VERSION;
+	hdr->core_count = PLATFORM_CORE_COUNT;
+	hdr->block_offset = sizeof(*hdr);
+	hdr->block_size = IMX_TELEM_BLOCK_SIZE;
+	hdr->counter_freq = plat_get_syscnt_freq2();
+
+	/* The header is complete once the magic is there */
+	dmbst();
+	hdr->magic = IMX_TELEM_MAGIC;
+
+	telem_blocks = (uint64_t *)(IMX_TELEMETRY_BASE + sizeof(*hdr));
+
+	INFO("BL31: EL3 telemetry at 0x%lx\n", (unsigned long)IMX_TELEMETRY_BASE);
+}
+#else
+void imx_telem_init(void)
+{
+	telem_blocks = telem_counters;
+}
+#endif
@@ -0,0 +1,210 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef IMX_TELEMETRY_H
+#define IMX_TELEMETRY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <arch_helpers.h>
+#include <lib/spinlock.h>
+#include <lib/utils_def.h>
+
+/* Built on the platforms which set IMX_TELEMETRY only */
+#ifndef IMX_TELEMETRY
+#define IMX_TELEMETRY			0
+#endif
+
+/*
+ * Set by the platforms building imx_telemetry.c, for IMX_TELEMETRY or for the
+ * debugfs stats files, which keep the counters in secure memory when there is
+ * no telemetry region.
+ */
+#ifndef IMX_TELEM_HOOKS
+#define IMX_TELEM_HOOKS			0
+#endif
+
+#define IMX_TELEM_MAGIC			U(0x54584d49)	/* "IMXT" */
+#define IMX_TELEM_VERSION		U(2)
+
+/*
+ * The region starts with a 64 byte header, followed by one block of
+ * IMX_TELEM_COUNTERS 64-bit counters per core, in core position order. Each
+ * core only writes its own block, and each counter is written with a single
+ * store, so they can be read at any time without locking. Counters ending in
+ * _TICKS are in system counter ticks, at 'counter_freq' Hz.
+ */
+struct imx_telem_hdr {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t core_count;
+	/* offset of the first block from the region base, and size of each */
+	uint32_t block_offset;
+	uint32_t block_size;
+	uint32_t counter_freq;
+	uint32_t reserved[10];
+};
+
+/* SiP calls, slot n for FID 0xC2000000 + n and the last slot for the others */
+#define IMX_TELEM_SIP_CALLS		U(0)
+#define IMX_TELEM_SIP_SLOTS		U(16)
+/* Times the core was powered up and down */
+#define IMX_TELEM_PSCI_CPU_ON		U(16)
+#define IMX_TELEM_PSCI_CPU_OFF		U(17)
+/* Suspend entries and exits, time suspended and spent entering and exiting */
+#define IMX_TELEM_PSCI_SUSPEND		U(18)
+#define IMX_TELEM_PSCI_RESUME		U(19)
+#define IMX_TELEM_PSCI_SUSPEND_TICKS	U(20)
+#define IMX_TELEM_PSCI_ENTRY_TICKS	U(21)
+#define IMX_TELEM_PSCI_EXIT_TICKS	U(22)
+/* Round trips to the SCU or ELE, including waiting for the mailbox */
+#define IMX_TELEM_MBOX_CALLS		U(23)
+#define IMX_TELEM_MBOX_TICKS		U(24)
+#define IMX_TELEM_MBOX_MAX_TICKS	U(25)
+/* DDR frequency switches done by the core, and time parked for the others */
+#define IMX_TELEM_DVFS_SWITCHES		U(26)
+#define IMX_TELEM_DVFS_SWITCH_TICKS	U(27)
+#define IMX_TELEM_DVFS_WAIT_TICKS	U(28)
+/* Locks taken, those found held by another core and time waited for them */
+#define IMX_TELEM_LOCK_ACQUIRES		U(29)
+#define IMX_TELEM_LOCK_CONTENDED	U(30)
+#define IMX_TELEM_LOCK_WAIT_TICKS	U(31)
+/*
+ * CPU_ON of the core: time from the request to the core let out of reset, from
+ * there to the platform hook, and in total, then the longest one. The other
+ * cores count the requests which failed to power the core up.
+ */
+#define IMX_TELEM_CPU_ON_PWR_TICKS	U(32)
+#define IMX_TELEM_CPU_ON_BOOT_TICKS	U(33)
+#define IMX_TELEM_CPU_ON_TICKS		U(34)
+#define IMX_TELEM_CPU_ON_MAX_TICKS	U(35)
+#define IMX_TELEM_CPU_ON_FAILS		U(36)
+#define IMX_TELEM_COUNTERS		U(40)
+
+/* Mailbox round trips under 1us, 2us, 4us... and the longer ones last */
+#define IMX_TELEM_MBOX_BUCKETS		U(12)
+/* Latest DDR frequency switches kept */
+#define IMX_TELEM_DVFS_HISTORY		U(16)
+
+struct imx_telem_dvfs_switch {
+	uint64_t start;
+	uint64_t ticks;
+	uint32_t from_mts;
+	uint32_t to_mts;
+};
+
+#if IMX_TELEM_HOOKS
+
+void imx_telem_init(void);
+uint64_t *imx_telem_my_block(void);
+uint64_t *imx_telem_block(unsigned int core);
+
+void imx_telem_sip_call(uint32_t smc_fid);
+void imx_telem_add_time(unsigned int counter, uint64_t start);
+void imx_telem_mbox_call(uint64_t start);
+void imx_telem_suspend_enter(uint64_t start);
+void imx_telem_suspend_exit(uint64_t start);
+void imx_telem_lock_acquired(uint64_t start, bool contended);
+void imx_telem_dvfs_switch(unsigned int from_mts, unsigned int to_mts,
+			   uint64_t start);
+void imx_telem_cpu_on_request(unsigned int core);
+void imx_telem_cpu_on_release(unsigned int core);
+void imx_telem_cpu_on_done(uint64_t start);
+
+#if USE_DEBUGFS
+uint32_t imx_telem_mbox_bucket(unsigned int bucket);
+unsigned int imx_telem_dvfs_history(struct imx_telem_dvfs_switch *hist);
+#endif
+
+static inline void imx_telem_inc(unsigned int counter)
+{
+	uint64_t *block = imx_telem_my_block();
+
+	if (block != NULL) {
+		block[counter]++;
+	}
+}
+
+static inline uint64_t imx_telem_now(void)
+{
+	return read_cntpct_el0();
+}
+
+static inline void imx_telem_spin_lock(spinlock_t *lock)
+{
+	uint64_t start = read_cntpct_el0();
+	bool contended = (lock->lock != 0U);
+
+	spin_lock(lock);
+	imx_telem_lock_acquired(start, contended);
+}
+
+#else
+
+static inline void imx_telem_init(void)
+{
+}
+
+static inline void imx_telem_sip_call(uint32_t smc_fid)
+{
+}
+
+static inline void imx_telem_add_time(unsigned int counter, uint64_t start)
+{
+}
+
+static inline void imx_telem_mbox_call(uint64_t start)
+{
+}
+
+static inline void imx_telem_suspend_enter(uint64_t start)
+{
+}
+
+static inline void imx_telem_suspend_exit(uint64_t start)
+{
+}
+
+static inline void imx_telem_lock_acquired(uint64_t start, bool contended)
+{
+}
+
+static inline void imx_telem_dvfs_switch(unsigned int from_mts,
+					 unsigned int to_mts, uint64_t start)
+{
+}
+
+static inline void imx_telem_cpu_on_request(unsigned int core)
+{
+}
+
+static inline void imx_telem_cpu_on_release(unsigned int core)
+{
+}
+
+static inline void imx_telem_cpu_on_done(uint64_t start)
+{
+}
+
+static inline void imx_telem_inc(unsigned int counter)
+{
+}
+
+/* The time is not read at all without telemetry */
+static inline uint64_t imx_telem_now(void)
+{
+	return 0U;
+}
+
+static inline void imx_telem_spin_lock(spinlock_t *lock)
+{
+	spin_lock(lock);
+}
+
+#endif /* IMX_TELEM_HOOKS */
+
+#endif /* IMX_TELEMETRY_H */
@@ -0,0 +1,22 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef IMX_TICKS_H
+#define IMX_TICKS_H
+
+#include <platform_def.h>
+
+/*
+ * Convert system counter ticks to microseconds. The whole seconds are split off
+ * first, so that tick counts accumulated over the uptime cannot overflow.
+ */
+static inline unsigned long long imx_ticks_to_us(unsigned long long ticks)
+{
+	return ((ticks / COUNTER_FREQUENCY) * 1000000ULL) +
+	       (((ticks % COUNTER_FREQUENCY) * 1000000ULL) / COUNTER_FREQUENCY);
+}
+
+#endif /* IMX_TICKS_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -13,6 +13,7 @@
 
 int console_imx_uart_register(uintptr_t baseaddr, uint32_t clock, uint32_t baud,
 			      console_t *console);
+int console_imx_uart_try_putc(int c, console_t *console);
 #endif /*__ASSEMBLER__*/
 
 #endif  /* IMX_UART_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2019, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, ARM Limited and Contributors. All rights reserved.
  * Copyright (C) 2016 Freescale Semiconductor, Inc.
  * Copyright 2017-2019 NXP
  *
@@ -64,6 +64,35 @@ void sc_ipc_read(sc_ipc_t ipc, void *data);
  */
 void sc_ipc_write(sc_ipc_t ipc, const void *data);
 
+/*!
+ * This function starts queuing the requests the calling core makes which
+ * only return an error code, instead of sending each of them and waiting
+ * for its response in turn.
+ *
+ * Any other request sends the queued ones first. The queued requests return
+ * SC_ERR_NONE to their callers, as they are only sent later. Each of them
+ * which the SCFW fails is then reported with an error message, and the
+ * first failure is returned by sc_ipc_batch_flush().
+ */
+void sc_ipc_batch_start(void);
+
+/*!
+ * This function sends the requests queued since sc_ipc_batch_start() and
+ * stops queuing.
+ *
+ * @param[in]     ipc         id of channel to write to
+ *
+ * @return Returns the first error reported by the SCFW for the queued
+ *         requests, or SC_ERR_NONE.
+ */
+sc_err_t sc_ipc_batch_flush(sc_ipc_t ipc);
+
+/*!
+ * This function returns the number of requests sent to the SCFW since
+ * boot, including the ones sent in batches.
+ */
+unsigned int sc_ipc_get_rpc_count(void);
+
 extern sc_ipc_t ipc_handle;
 
 #endif /* SCI_IPC_H */
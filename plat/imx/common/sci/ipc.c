@@ -1,16 +1,29 @@
 /*
- * Copyright (c) 2015-2019, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, ARM Limited and Contributors. All rights reserved.
  * Copyright 2017-2019 NXP
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <stdbool.h>
+
+#include <common/debug.h>
+#include <plat/common/platform.h>
+#include <platform_def.h>
 #include <sci/sci_scfw.h>
 #include <sci/sci_ipc.h>
 #include <sci/sci_rpc.h>
+#include <sci/svc/rm/sci_rm_api.h>
 #include <stdlib.h>
 
+#include <imx_telemetry.h>
+
 #include "imx8_mu.h"
+#include "svc/pm/sci_pm_rpc.h"
+#include "svc/rm/sci_rm_rpc.h"
+
+/* Requests a core can queue before they are sent */
+#define SC_BATCH_MAX	16U
 
 sc_ipc_t ipc_handle;
 
@@ -20,15 +33,166 @@ DEFINE_BAKERY_LOCK(sc_ipc_bakery_lock);
 #define sc_ipc_lock()		bakery_lock_get(&sc_ipc_bakery_lock)
 #define sc_ipc_unlock()		bakery_lock_release(&sc_ipc_bakery_lock)
 
+/* Requests queued by a core between sc_ipc_batch_start() and _flush() */
+static struct {
+	bool open;
+	unsigned int count;
+	sc_err_t err;
+	sc_rpc_msg_t msg[SC_BATCH_MAX];
+} sc_batch[PLATFORM_CORE_COUNT];
+
+/* Requests sent to the SCFW since boot */
+static unsigned int sc_rpc_count;
+
+/*
+ * Only requests which fit in the MU transmit registers and whose response is
+ * nothing but an error code can be queued.
+ */
+static bool sc_rpc_is_batchable(const sc_rpc_msg_t *msg)
+{
+	if (RPC_SIZE(msg) > MU_TR_COUNT)
+		return false;
+
+	if (RPC_SVC(msg) == SC_RPC_SVC_PM) {
+		switch (RPC_FUNC(msg)) {
+		case PM_FUNC_SET_RESOURCE_POWER_MODE:
+		case PM_FUNC_REQ_LOW_POWER_MODE:
+		case PM_FUNC_REQ_CPU_LOW_POWER_MODE:
+		case PM_FUNC_SET_CPU_RESUME:
+		case PM_FUNC_REQ_SYS_IF_POWER_MODE:
+		case PM_FUNC_CLOCK_ENABLE:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	if (RPC_SVC(msg) == SC_RPC_SVC_RM) {
+		switch (RPC_FUNC(msg)) {
+		case RM_FUNC_SET_PARENT:
+		case RM_FUNC_MOVE_ALL:
+		case RM_FUNC_ASSIGN_RESOURCE:
+		case RM_FUNC_SET_RESOURCE_MOVABLE:
+		case RM_FUNC_SET_PERIPHERAL_PERMISSIONS:
+		case RM_FUNC_SET_MEMREG_PERMISSIONS:
+		case RM_FUNC_SET_PAD_MOVABLE:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * Send the queued requests back to back. Each request is written before the
+ * response to the previous one is read, so the SCFW handles a request while
+ * the next one is being written, and the channel is locked only once.
+ *
+ * Each request counts as one round trip, from its write to its response. As
+ * their callers have already returned, the requests the SCFW fails are
+ * reported here.
+ */
+static void sc_ipc_batch_send(sc_ipc_t ipc, unsigned int core)
+{
+	uint64_t start[SC_BATCH_MAX];
+	sc_rpc_msg_t *msg = sc_batch[core].msg;
+	sc_rpc_msg_t resp;
+	sc_err_t err;
+	unsigned int i;
+
+	if (sc_batch[core].count == 0U)
+		return;
+
+	sc_ipc_lock();
+
+	start[0] = imx_telem_now();
+	sc_ipc_write(ipc, &msg[0]);
+	for (i = 0U; i < sc_batch[core].count; i++) {
+		if ((i + 1U) < sc_batch[core].count) {
+			start[i + 1U] = imx_telem_now();
+			sc_ipc_write(ipc, &msg[i + 1U]);
+		}
+
+		sc_ipc_read(ipc, &resp);
+		sc_rpc_count++;
+		imx_telem_mbox_call(start[i]);
+
+		err = (sc_err_t)RPC_R8(&resp);
+		if (err != SC_ERR_NONE) {
+			ERROR("SCFW request %u/%u failed: %u\n",
+			      RPC_SVC(&msg[i]), RPC_FUNC(&msg[i]), err);
+			if (sc_batch[core].err == SC_ERR_NONE)
+				sc_batch[core].err = err;
+		}
+	}
+
+	sc_ipc_unlock();
+
+	sc_batch[core].count = 0U;
+}
+
+void sc_ipc_batch_start(void)
+{
+	unsigned int core = plat_my_core_pos();
+
+	sc_batch[core].open = true;
+	sc_batch[core].count = 0U;
+	sc_batch[core].err = SC_ERR_NONE;
+}
+
+sc_err_t sc_ipc_batch_flush(sc_ipc_t ipc)
+{
+	unsigned int core = plat_my_core_pos();
+
+	sc_ipc_batch_send(ipc, core);
+	sc_batch[core].open = false;
+
+	return sc_batch[core].err;
+}
+
 void sc_call_rpc(sc_ipc_t ipc, sc_rpc_msg_t *msg, sc_bool_t no_resp)
 {
+	unsigned int core = plat_my_core_pos();
+	uint64_t start;
+
+	if (sc_batch[core].open) {
+		if (!no_resp && sc_rpc_is_batchable(msg)) {
+			if (sc_batch[core].count == SC_BATCH_MAX)
+				sc_ipc_batch_send(ipc, core);
+
+			sc_batch[core].msg[sc_batch[core].count++] = *msg;
+
+			/*
+			 * The status is not known yet. Failures are reported
+			 * when the request is sent and by
+			 * sc_ipc_batch_flush().
+			 */
+			RPC_R8(msg) = SC_ERR_NONE;
+			return;
+		}
+
+		/* Keep the requests in order */
+		sc_ipc_batch_send(ipc, core);
+	}
+
+	start = imx_telem_now();
 	sc_ipc_lock();
 
 	sc_ipc_write(ipc, msg);
 	if (!no_resp)
 		sc_ipc_read(ipc, msg);
+	sc_rpc_count++;
 
 	sc_ipc_unlock();
+
+	imx_telem_mbox_call(start);
+}
+
+unsigned int sc_ipc_get_rpc_count(void)
+{
+	return sc_rpc_count;
 }
 
 sc_err_t sc_ipc_open(sc_ipc_t *ipc, sc_ipc_id_t id)
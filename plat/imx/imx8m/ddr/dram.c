@@ -12,9 +12,14 @@
 
 #include <dram.h>
 #include <gpc.h>
+#include <imx_sip_svc.h>
+#include <imx_telemetry.h>
+#include <imx_ticks.h>
 
 #define IMX_SIP_DDR_DVFS_GET_FREQ_COUNT		0x10
 #define IMX_SIP_DDR_DVFS_GET_FREQ_INFO		0x11
+#define IMX_SIP_DDR_DVFS_GET_FSP_STATS		0x12
+#define IMX_SIP_DDR_DVFS_GET_SWITCH_STATS	0x13
 
 struct dram_info dram_info;
 
@@ -27,7 +32,20 @@ static uint8_t dram_timing_saved[13 * 1024] __aligned(8);
 #endif
 
 static volatile uint32_t wfe_done;
-static volatile bool wait_ddrc_hwffc_done = true;
+static volatile bool wait_ddrc_hwffc_done;
+/* incremented each time a frequency change is done */
+static volatile uint32_t dvfs_seq;
+
+/* time spent in each setpoint and cost of the frequency changes */
+static struct {
+	uint64_t fsp_ticks[MAX_FSP_NUM];
+	uint32_t fsp_entries[MAX_FSP_NUM];
+	uint64_t fsp_since;
+	uint32_t switch_count;
+	uint64_t rendezvous_ticks;
+	uint64_t rendezvous_max_ticks;
+	uint64_t switch_ticks;
+} dvfs_stats;
 
 unsigned int dev_fsp = 0x1;
 
@@ -187,6 +205,7 @@ static uint64_t waiting_dvfs(uint32_t id, uint32_t flags,
 {
 	uint64_t mpidr = read_mpidr_el1();
 	unsigned int cpu_id = MPIDR_AFFLVL0_VAL(mpidr);
+	uint64_t start = imx_telem_now();
 	uint32_t irq;
 
 	irq = plat_ic_acknowledge_interrupt();
@@ -194,8 +213,23 @@ static uint64_t waiting_dvfs(uint32_t id, uint32_t flags,
 		plat_ic_end_of_interrupt(irq);
 	}
 
+#if IMX_DDR_GOVERNOR
+	if (irq == IMX_IRQ_SEC_PHY_TIMER) {
+		dram_gov_sample();
+		return 0;
+	}
+
+	/* the sampling may have been handed over to this core */
+	dram_gov_adopt();
+#endif
+
+	/* the frequency change this SGI was raised for may be done already */
+	if (!wait_ddrc_hwffc_done) {
+		return 0;
+	}
+
 	/* set the WFE done status */
-	spin_lock(&dfs_lock);
+	imx_telem_spin_lock(&dfs_lock);
 	wfe_done |= (1 << cpu_id * 8);
 	dsb();
 	spin_unlock(&dfs_lock);
@@ -208,6 +242,8 @@ static uint64_t waiting_dvfs(uint32_t id, uint32_t flags,
 		wfe();
 	}
 
+	imx_telem_add_time(IMX_TELEM_DVFS_WAIT_TICKS, start);
+
 	return 0;
 }
 
@@ -278,13 +314,131 @@ void dram_info_init(unsigned long dram_timing_base)
 		dcsw_op_all(DCCSW);
 		lpddr4_swffc(&dram_info, dev_fsp, 0x0);
 		dev_fsp = (~dev_fsp) & 0x1;
+		dram_info.current_fsp = 0x0;
 	} else if (current_fsp != 0x0) {
 		/* flush the L1/L2 cache */
 #ifdef IMX8M_DDR4_DVFS
 		dcsw_op_all(DCCSW);
 		ddr4_swffc(&dram_info, 0x0);
+		dram_info.current_fsp = 0x0;
 #endif
 	}
+
+	dvfs_stats.fsp_since = read_cntpct_el0();
+}
+
+static void dram_dvfs_account(unsigned int fsp_index)
+{
+	uint64_t now = read_cntpct_el0();
+	unsigned int cur = dram_info.current_fsp;
+
+	if (cur < MAX_FSP_NUM) {
+		dvfs_stats.fsp_ticks[cur] += now - dvfs_stats.fsp_since;
+	}
+	dvfs_stats.fsp_since = now;
+
+	if (fsp_index < MAX_FSP_NUM) {
+		dvfs_stats.fsp_entries[fsp_index]++;
+	}
+}
+
+/*
+ * Switch the DDR to the setpoint 'fsp_index', once all the other cores set in
+ * 'online_cores' (one bit every 8 bits) are waiting in WFE.
+ */
+void dram_dvfs_switch(unsigned int fsp_index, uint32_t online_cores)
+{
+	uint64_t mpidr = read_mpidr_el1();
+	unsigned int cpu_id = MPIDR_AFFLVL0_VAL(mpidr);
+	unsigned int from = dram_info.current_fsp;
+	uint64_t start, rendezvous;
+
+	start = read_cntpct_el0();
+
+	wait_ddrc_hwffc_done = true;
+	dsb();
+
+	/* trigger the SGI IPI to info other cores */
+	for (int i = 0; i < PLATFORM_CORE_COUNT; i++) {
+		if (cpu_id != i && (online_cores & (0x1 << (i * 8)))) {
+			plat_ic_raise_el3_sgi(0x8, i);
+		}
+	}
+#if defined(PLAT_imx8mq)
+	for (unsigned int i = 0; i < PLATFORM_CORE_COUNT; i++) {
+		if (i != cpu_id && online_cores & (1 << (i * 8))) {
+			imx_gpc_core_wake(1 << i);
+		}
+	}
+#endif
+	/* make sure all the core in WFE */
+	online_cores &= ~(0x1 << (cpu_id * 8));
+	while (1) {
+		if ((wfe_done & online_cores) == online_cores) {
+			break;
+		}
+	}
+
+	rendezvous = read_cntpct_el0() - start;
+
+	/* flush the L1/L2 cache */
+	dcsw_op_all(DCCSW);
+
+	if (dram_info.dram_type == DDRC_LPDDR4) {
+		lpddr4_swffc(&dram_info, dev_fsp, fsp_index);
+		dev_fsp = (~dev_fsp) & 0x1;
+	} else {
+#ifdef IMX8M_DDR4_DVFS
+		ddr4_swffc(&dram_info, fsp_index);
+#endif
+	}
+
+	dram_dvfs_account(fsp_index);
+	dram_info.current_fsp = fsp_index;
+	wfe_done = 0;
+	dvfs_seq++;
+	wait_ddrc_hwffc_done = false;
+	dsb();
+	sev();
+	isb();
+
+	dvfs_stats.switch_count++;
+	dvfs_stats.rendezvous_ticks += rendezvous;
+	if (rendezvous > dvfs_stats.rendezvous_max_ticks) {
+		dvfs_stats.rendezvous_max_ticks = rendezvous;
+	}
+	dvfs_stats.switch_ticks += read_cntpct_el0() - start - rendezvous;
+
+	imx_telem_dvfs_switch(dram_info.timing_info->fsp_table[from],
+			      dram_info.timing_info->fsp_table[fsp_index], start);
+}
+
+/*
+ * Wait in WFE for a frequency change which counts on this core, from a path
+ * that runs with interrupts masked and so cannot take the SGI in time. The SGI
+ * is dropped if it is already pending.
+ */
+void dram_dvfs_join(void)
+{
+	uint64_t mpidr = read_mpidr_el1();
+	unsigned int cpu_id = MPIDR_AFFLVL0_VAL(mpidr);
+	uint32_t seq = dvfs_seq;
+	uint64_t start = imx_telem_now();
+
+	imx_telem_spin_lock(&dfs_lock);
+	wfe_done |= (1 << cpu_id * 8);
+	dsb();
+	spin_unlock(&dfs_lock);
+
+	while (dvfs_seq == seq) {
+		wfe();
+	}
+
+	imx_telem_add_time(IMX_TELEM_DVFS_WAIT_TICKS, start);
+
+	if (plat_ic_get_pending_interrupt_id() == 0x8U) {
+		plat_ic_end_of_interrupt(plat_ic_acknowledge_interrupt());
+	}
 }
 
 /*
@@ -332,11 +486,30 @@ int dram_dvfs_get_freq_info(void *handle, u_register_t index)
 	}
 }
 
+/*
+ * For a setpoint, return its data rate, the time spent in it in microseconds
+ * and how many times it has been switched to.
+ */
+static int dram_dvfs_get_fsp_stats(void *handle, u_register_t index)
+{
+	uint64_t ticks;
+
+	if (index >= dram_info.num_fsp) {
+		SMC_RET1(handle, -3);
+	}
+
+	ticks = dvfs_stats.fsp_ticks[index];
+	if (index == (u_register_t)dram_info.current_fsp) {
+		ticks += read_cntpct_el0() - dvfs_stats.fsp_since;
+	}
+
+	SMC_RET3(handle, dram_info.timing_info->fsp_table[index],
+		 imx_ticks_to_us(ticks), dvfs_stats.fsp_entries[index]);
+}
+
 int dram_dvfs_handler(uint32_t smc_fid, void *handle,
 	u_register_t x1, u_register_t x2, u_register_t x3)
 {
-	uint64_t mpidr = read_mpidr_el1();
-	unsigned int cpu_id = MPIDR_AFFLVL0_VAL(mpidr);
 	unsigned int fsp_index = x1;
 	uint32_t online_cores = x2;
 
@@ -344,50 +517,33 @@ int dram_dvfs_handler(uint32_t smc_fid, void *handle,
 		SMC_RET1(handle, dram_info.num_fsp);
 	} else if (x1 == IMX_SIP_DDR_DVFS_GET_FREQ_INFO) {
 		return dram_dvfs_get_freq_info(handle, x2);
+	} else if (x1 == IMX_SIP_DDR_DVFS_GET_FSP_STATS) {
+		return dram_dvfs_get_fsp_stats(handle, x2);
+	} else if (x1 == IMX_SIP_DDR_DVFS_GET_SWITCH_STATS) {
+		SMC_RET4(handle, dvfs_stats.switch_count,
+			 imx_ticks_to_us(dvfs_stats.rendezvous_ticks),
+			 imx_ticks_to_us(dvfs_stats.rendezvous_max_ticks),
+			 imx_ticks_to_us(dvfs_stats.switch_ticks));
 	} else if (x1 < 3U) {
-		wait_ddrc_hwffc_done = true;
-		dsb();
-
-		/* trigger the SGI IPI to info other cores */
-		for (int i = 0; i < PLATFORM_CORE_COUNT; i++) {
-			if (cpu_id != i && (online_cores & (0x1 << (i * 8)))) {
-				plat_ic_raise_el3_sgi(0x8, i);
-			}
-		}
-#if defined(PLAT_imx8mq)
-		for (unsigned int i = 0; i < PLATFORM_CORE_COUNT; i++) {
-			if (i != cpu_id && online_cores & (1 << (i * 8))) {
-				imx_gpc_core_wake(1 << i);
-			}
-		}
-#endif
-		/* make sure all the core in WFE */
-		online_cores &= ~(0x1 << (cpu_id * 8));
-		while (1) {
-			if (online_cores == wfe_done) {
-				break;
-			}
-		}
-
-		/* flush the L1/L2 cache */
-		dcsw_op_all(DCCSW);
-
-		if (dram_info.dram_type == DDRC_LPDDR4) {
-			lpddr4_swffc(&dram_info, dev_fsp, fsp_index);
-			dev_fsp = (~dev_fsp) & 0x1;
-		} else {
-#ifdef IMX8M_DDR4_DVFS
-			ddr4_swffc(&dram_info, fsp_index);
-#endif
-		}
+		/* the normal world takes over from the governor, if any */
+		dram_gov_stop();
 
-		dram_info.current_fsp = fsp_index;
-		wait_ddrc_hwffc_done = false;
-		wfe_done = 0;
-		dsb();
-		sev();
-		isb();
+		dram_dvfs_switch(fsp_index, online_cores);
 	}
 
 	SMC_RET1(handle, 0);
 }
+
+#if SMC_LEAF_FASTPATH
+static u_register_t dram_dvfs_get_freq_count(u_register_t x1, u_register_t x2,
+					     u_register_t x3, u_register_t x4)
+{
+	imx_telem_sip_call(IMX_SIP_DDR_DVFS);
+
+	return dram_info.num_fsp;
+}
+
+DECLARE_RT_SVC_LEAF(imx_sip_ddr_dvfs_freq_count, IMX_SIP_DDR_DVFS,
+		    RT_SVC_LEAF_MATCH_X1, IMX_SIP_DDR_DVFS_GET_FREQ_COUNT,
+		    dram_dvfs_get_freq_count);
+#endif
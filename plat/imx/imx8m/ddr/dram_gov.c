@@ -0,0 +1,328 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <arch_helpers.h>
+#include <bl31/interrupt_mgmt.h>
+#include <common/debug.h>
+#include <drivers/arm/gic_common.h>
+#include <lib/mmio.h>
+#include <lib/spinlock.h>
+#include <plat/common/platform.h>
+
+#include <dram.h>
+#include <imx_telemetry.h>
+
+/* DDR controller performance counters, counter 0 counts cycles */
+#define DDR_PERF_CNTL(n)		(IMX_DDR_PERF_BASE + 0x0 + ((n) * 4U))
+#define DDR_PERF_COUNT(n)		(IMX_DDR_PERF_BASE + 0x20 + ((n) * 4U))
+#define DDR_PERF_CNTL_CLEAR		BIT(1)
+#define DDR_PERF_CNTL_EN		BIT(2)
+#define DDR_PERF_CNTL_CSV_SHIFT		24
+
+#define DDR_PERF_CYCLES			0U
+#define DDR_PERF_READ_CYCLES		1U
+#define DDR_PERF_WRITE_CYCLES		2U
+
+#define DDR_PERF_EVENT_CYCLES		U(0x00)
+#define DDR_PERF_EVENT_READ_CYCLES	U(0x2a)
+#define DDR_PERF_EVENT_WRITE_CYCLES	U(0x2b)
+
+/* Switch to a faster setpoint once the load, in percent, gets above this */
+#define DRAM_GOV_UP_THRESHOLD		70U
+/* The setpoint picked is the slowest one the load stays below this with */
+#define DRAM_GOV_TARGET_LOAD		50U
+/* Samples in a row a slower setpoint must be picked before switching to it */
+#define DRAM_GOV_DOWN_SAMPLES		4U
+
+#define DRAM_GOV_PERIOD_TICKS	\
+	((COUNTER_FREQUENCY / 1000U) * IMX_DDR_GOV_PERIOD_MS)
+
+static spinlock_t gov_lock;
+static volatile bool gov_enabled;
+static volatile bool gov_switching;
+static volatile uint32_t gov_seq;
+static unsigned int gov_cpu;
+static unsigned int gov_down_samples;
+
+/*
+ * Cores which are running, and those the frequency change in progress waits
+ * for, with one bit every 8 bits as in IMX_SIP_DDR_DVFS.
+ */
+static uint32_t gov_cores;
+static uint32_t gov_waiting;
+
+static inline uint32_t dram_gov_core_bit(unsigned int cpu)
+{
+	return BIT_32(cpu * 8U);
+}
+
+static void dram_gov_counters_start(void)
+{
+	static const uint32_t events[] = {
+		[DDR_PERF_CYCLES] = DDR_PERF_EVENT_CYCLES,
+		[DDR_PERF_READ_CYCLES] = DDR_PERF_EVENT_READ_CYCLES,
+		[DDR_PERF_WRITE_CYCLES] = DDR_PERF_EVENT_WRITE_CYCLES,
+	};
+	unsigned int i;
+
+	/* All the counters stop with the cycle counter, so start it last */
+	for (i = ARRAY_SIZE(events); i > 0U; i--) {
+		mmio_write_32(DDR_PERF_CNTL(i - 1U), 0U);
+		mmio_write_32(DDR_PERF_CNTL(i - 1U), DDR_PERF_CNTL_EN |
+			      DDR_PERF_CNTL_CLEAR |
+			      (events[i - 1U] << DDR_PERF_CNTL_CSV_SHIFT));
+	}
+}
+
+static void dram_gov_timer_start(void)
+{
+	plat_ic_set_interrupt_type(IMX_IRQ_SEC_PHY_TIMER, INTR_TYPE_EL3);
+	plat_ic_set_interrupt_priority(IMX_IRQ_SEC_PHY_TIMER,
+				       GIC_HIGHEST_SEC_PRIORITY);
+	plat_ic_enable_interrupt(IMX_IRQ_SEC_PHY_TIMER);
+
+	write_cntps_tval_el1(DRAM_GOV_PERIOD_TICKS);
+	write_cntps_ctl_el1(CNTP_CTL_ENABLE_BIT);
+}
+
+/*
+ * Pick the slowest setpoint the load, measured at the current setpoint,
+ * would stay below DRAM_GOV_TARGET_LOAD with, or the fastest one if none.
+ */
+static unsigned int dram_gov_target(unsigned int load)
+{
+	const unsigned int *rates = dram_info.timing_info->fsp_table;
+	uint64_t demand = (uint64_t)load * rates[dram_info.current_fsp];
+	unsigned int target = 0U;
+	unsigned int i;
+
+	for (i = 1U; i < dram_info.num_fsp; i++) {
+		if (rates[i] > rates[target]) {
+			target = i;
+		}
+	}
+
+	for (i = 0U; i < dram_info.num_fsp; i++) {
+		if ((rates[i] < rates[target]) &&
+		    (demand <= ((uint64_t)DRAM_GOV_TARGET_LOAD * rates[i]))) {
+			target = i;
+		}
+	}
+
+	return target;
+}
+
+/*
+ * Called on the secure physical timer interrupt. Measure how busy the DDR has
+ * been since the last sample and switch to another setpoint if needed: right
+ * away to go faster, after DRAM_GOV_DOWN_SAMPLES samples to go slower.
+ */
+void dram_gov_sample(void)
+{
+	const unsigned int *rates = dram_info.timing_info->fsp_table;
+	unsigned int cur = dram_info.current_fsp;
+	uint32_t cycles, busy, cores;
+	unsigned int load, target;
+
+	if (!gov_enabled) {
+		write_cntps_ctl_el1(0U);
+		return;
+	}
+
+	cycles = mmio_read_32(DDR_PERF_COUNT(DDR_PERF_CYCLES));
+	busy = mmio_read_32(DDR_PERF_COUNT(DDR_PERF_READ_CYCLES)) +
+	       mmio_read_32(DDR_PERF_COUNT(DDR_PERF_WRITE_CYCLES));
+
+	dram_gov_counters_start();
+	write_cntps_tval_el1(DRAM_GOV_PERIOD_TICKS);
+
+	if (cycles == 0U) {
+		return;
+	}
+
+	load = (unsigned int)(((uint64_t)busy * 100U) / cycles);
+	target = dram_gov_target(load);
+
+	if (target == cur) {
+		gov_down_samples = 0U;
+		return;
+	}
+
+	if (rates[target] > rates[cur]) {
+		gov_down_samples = 0U;
+		if (load < DRAM_GOV_UP_THRESHOLD) {
+			return;
+		}
+	} else if (++gov_down_samples < DRAM_GOV_DOWN_SAMPLES) {
+		return;
+	}
+
+	gov_down_samples = 0U;
+
+	imx_telem_spin_lock(&gov_lock);
+	if (!gov_enabled) {
+		spin_unlock(&gov_lock);
+		return;
+	}
+	cores = gov_cores;
+	gov_waiting = cores;
+	gov_switching = true;
+	spin_unlock(&gov_lock);
+
+	VERBOSE("DDR load %u%%, switching to %u MTS\n", load, rates[target]);
+
+	dram_dvfs_switch(target, cores);
+
+	imx_telem_spin_lock(&gov_lock);
+	gov_switching = false;
+	gov_waiting = 0U;
+	gov_seq++;
+	spin_unlock(&gov_lock);
+
+	dsb();
+	sev();
+}
+
+/*
+ * Stop sampling. Called when the normal world asks for a setpoint itself, and
+ * so manages the DDR frequency from then on.
+ */
+void dram_gov_stop(void)
+{
+	uint32_t bit = dram_gov_core_bit(plat_my_core_pos());
+	bool join;
+
+	imx_telem_spin_lock(&gov_lock);
+	gov_enabled = false;
+	join = gov_switching && ((gov_waiting & bit) != 0U);
+	spin_unlock(&gov_lock);
+
+	/* The frequency change in progress waits for this core */
+	if (join) {
+		dram_dvfs_join();
+	}
+}
+
+/*
+ * Called on the SGI raised for a frequency change, which is also raised to
+ * hand the sampling over to another core. Start the timer on this core if it
+ * now samples and the timer is not running yet.
+ */
+void dram_gov_adopt(void)
+{
+	if (gov_enabled && (plat_my_core_pos() == gov_cpu) &&
+	    ((read_cntps_ctl_el1() & CNTP_CTL_ENABLE_BIT) == 0U)) {
+		dram_gov_counters_start();
+		dram_gov_timer_start();
+	}
+}
+
+/*
+ * Called on a core leaving the normal world to be powered down. If it samples,
+ * the secure physical timer of another running core takes over, as the timer
+ * of this core stops with it.
+ */
+void dram_gov_cpu_off(void)
+{
+	unsigned int cpu = plat_my_core_pos();
+	uint32_t bit = dram_gov_core_bit(cpu);
+	unsigned int next = PLATFORM_CORE_COUNT;
+	bool join, sampling;
+
+	imx_telem_spin_lock(&gov_lock);
+	gov_cores &= ~bit;
+	join = gov_switching && ((gov_waiting & bit) != 0U);
+	sampling = (cpu == gov_cpu);
+	if (sampling && gov_enabled) {
+		for (next = 0U; next < PLATFORM_CORE_COUNT; next++) {
+			if ((gov_cores & dram_gov_core_bit(next)) != 0U) {
+				gov_cpu = next;
+				break;
+			}
+		}
+	}
+	spin_unlock(&gov_lock);
+
+	if (join) {
+		dram_dvfs_join();
+	}
+
+	if (sampling) {
+		write_cntps_ctl_el1(0U);
+	}
+
+	/* The SGI makes the new core start its timer */
+	if (next < PLATFORM_CORE_COUNT) {
+		plat_ic_raise_el3_sgi(0x8, next);
+	}
+}
+
+/* Called on a core powered up, before it can access the DDR */
+void dram_gov_cpu_on(void)
+{
+	unsigned int cpu = plat_my_core_pos();
+	uint32_t seq;
+	bool busy;
+
+	imx_telem_spin_lock(&gov_lock);
+	/* Take the sampling over if the last core running it is off */
+	if ((gov_cores & dram_gov_core_bit(gov_cpu)) == 0U) {
+		gov_cpu = cpu;
+	}
+	gov_cores |= dram_gov_core_bit(cpu);
+	busy = gov_switching;
+	seq = gov_seq;
+	spin_unlock(&gov_lock);
+
+	/* A frequency change in progress does not wait for this core */
+	while (busy && (gov_seq == seq)) {
+		wfe();
+	}
+
+	/* The timer and counters may have lost their state */
+	if ((cpu == gov_cpu) && gov_enabled) {
+		dram_gov_counters_start();
+		dram_gov_timer_start();
+	}
+}
+
+/*
+ * Called on the last core before system suspend. The DDR comes out of
+ * retention at setpoint 0, so switch to it first.
+ */
+void dram_gov_suspend(void)
+{
+	if (gov_enabled && (dram_info.current_fsp != 0)) {
+		dram_dvfs_switch(0U, 0U);
+	}
+
+	gov_down_samples = 0U;
+}
+
+void dram_gov_init(void)
+{
+	if (dram_info.num_fsp < 2U) {
+		return;
+	}
+
+#ifndef IMX8M_DDR4_DVFS
+	if (dram_info.dram_type != DDRC_LPDDR4) {
+		return;
+	}
+#endif
+
+	gov_cpu = plat_my_core_pos();
+	gov_cores = dram_gov_core_bit(gov_cpu);
+	gov_enabled = true;
+
+	dram_gov_counters_start();
+	dram_gov_timer_start();
+
+	INFO("DDR governor sampling every %u ms\n", IMX_DDR_GOV_PERIOD_MS);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -8,6 +8,7 @@
 
 #include <arch.h>
 #include <arch_helpers.h>
+#include <common/bl_common.h>
 #include <common/debug.h>
 #include <common/runtime_svc.h>
 #include <lib/mmio.h>
@@ -17,11 +18,30 @@
 
 #include <gpc.h>
 #include <imx_sip_svc.h>
+#include <imx_telemetry.h>
 #include <plat_imx8.h>
 #include <imx_rdc.h>
 
 #define MAX_PLL_NUM	U(10)
 
+/* The core power up timing is counted in 32K OSC cycles, see imx_gpc_init() */
+#define CPU_PWR_ON_TIMEOUT_US	U(2000)
+
+/*
+ * Everything imx_set_cpu_pwr_on() writes for a core, worked out once at boot
+ * so that CPU_ON only does the register accesses themselves.
+ */
+struct imx_cpu_pwr_prog {
+	uintptr_t entry_gpr;
+	uint32_t entry_hi;
+	uint32_t entry_lo;
+	uintptr_t pgc_pcr;
+	uint32_t wfi_pdn;
+	uint32_t core_bit;
+};
+
+static struct imx_cpu_pwr_prog cpu_pwr_prog[PLATFORM_CORE_COUNT];
+
 static uint32_t gpc_imr_offset[] = { IMR1_CORE0_A53, IMR1_CORE1_A53, IMR1_CORE2_A53, IMR1_CORE3_A53, };
 
 DEFINE_BAKERY_LOCK(gpc_lock);
@@ -98,30 +118,81 @@ void imx_set_cpu_pwr_off(unsigned int core_id)
 	mmio_setbits_32(IMX_GPC_BASE + COREx_PGC_PCR(core_id), 0x1);
 }
 
-void imx_set_cpu_pwr_on(unsigned int core_id)
+/* Called from imx_gpc_init(), the cores always enter BL31 at BL31_START */
+void imx_gpc_cpu_pwr_init(void)
 {
-	bakery_lock_get(&gpc_lock);
+	uint64_t entry = (uint64_t)BL31_START >> 2;
+	unsigned int core_id;
+
+	for (core_id = 0U; core_id < PLATFORM_CORE_COUNT; core_id++) {
+		cpu_pwr_prog[core_id] = (struct imx_cpu_pwr_prog) {
+			.entry_gpr = IMX_SRC_BASE + SRC_GPR1_OFFSET + (core_id << 3),
+			.entry_hi = (uint32_t)(entry >> 22) & 0xffff,
+			.entry_lo = (uint32_t)entry & 0x003fffff,
+			.pgc_pcr = IMX_GPC_BASE + COREx_PGC_PCR(core_id),
+			.wfi_pdn = COREx_WFI_PDN(core_id),
+			.core_bit = BIT_32(core_id),
+		};
+	}
+}
+
+/*
+ * Power up a core and let it out of reset at BL31_START. The entry point is
+ * written while the GPC sequences the power up, and the wait for it is
+ * bounded so that a core which does not come up fails CPU_ON.
+ */
+int imx_set_cpu_pwr_on(unsigned int core_id)
+{
+	const struct imx_cpu_pwr_prog *prog = &cpu_pwr_prog[core_id];
+	uint64_t timeout;
 
-	/* clear the wfi power down bit of the core */
-	mmio_clrbits_32(IMX_GPC_BASE + LPCR_A53_AD, COREx_WFI_PDN(core_id));
+	/* only the core itself sets its wfi power down bit, and it is off */
+	if ((mmio_read_32(IMX_GPC_BASE + LPCR_A53_AD) & prog->wfi_pdn) != 0U) {
+		bakery_lock_get(&gpc_lock);
 
-	bakery_lock_release(&gpc_lock);
+		/* clear the wfi power down bit of the core */
+		mmio_clrbits_32(IMX_GPC_BASE + LPCR_A53_AD, prog->wfi_pdn);
+
+		bakery_lock_release(&gpc_lock);
+	}
 
 	/* assert the ncpuporeset */
-	mmio_clrbits_32(IMX_SRC_BASE + SRC_A53RCR1, (1 << core_id));
-	/* assert the pcg pcr bit of the core */
-	mmio_setbits_32(IMX_GPC_BASE + COREx_PGC_PCR(core_id), 0x1);
+	mmio_clrbits_32(IMX_SRC_BASE + SRC_A53RCR1, prog->core_bit);
+	/* assert the pcg pcr bit of the core, the only bit of the register */
+	mmio_write_32(prog->pgc_pcr, 0x1);
 	/* sw power up the core */
-	mmio_setbits_32(IMX_GPC_BASE + CPU_PGC_UP_TRG, (1 << core_id));
+	mmio_setbits_32(IMX_GPC_BASE + CPU_PGC_UP_TRG, prog->core_bit);
+
+	mmio_write_32(prog->entry_gpr, prog->entry_hi);
+	mmio_write_32(prog->entry_gpr + 4, prog->entry_lo);
 
 	/* wait for the power up finished */
-	while ((mmio_read_32(IMX_GPC_BASE + CPU_PGC_UP_TRG) & (1 << core_id)) != 0)
-		;
+	timeout = timeout_init_us(CPU_PWR_ON_TIMEOUT_US);
+	while ((mmio_read_32(IMX_GPC_BASE + CPU_PGC_UP_TRG) &
+		prog->core_bit) != 0U) {
+		if (timeout_elapsed(timeout)) {
+			ERROR("core %u did not power up\n", core_id);
+			/*
+			 * Withdraw the power up request and the PCR, but keep
+			 * the core in reset, so that a later CPU_ON starts
+			 * from the same state as this one.
+			 */
+			mmio_clrbits_32(IMX_GPC_BASE + CPU_PGC_UP_TRG,
+					prog->core_bit);
+			mmio_write_32(prog->pgc_pcr, 0x0);
+			return -ETIMEDOUT;
+		}
+	}
 
 	/* deassert the pcg pcr bit of the core */
-	mmio_clrbits_32(IMX_GPC_BASE + COREx_PGC_PCR(core_id), 0x1);
+	mmio_write_32(prog->pgc_pcr, 0x0);
+
+	imx_telem_cpu_on_release(core_id);
+
 	/* deassert the ncpuporeset */
-	mmio_setbits_32(IMX_SRC_BASE + SRC_A53RCR1, (1 << core_id));
+	mmio_setbits_32(IMX_SRC_BASE + SRC_A53RCR1, prog->core_bit);
+
+	return 0;
 }
 
 void imx_set_cpu_lpm(unsigned int core_id, bool pdn)
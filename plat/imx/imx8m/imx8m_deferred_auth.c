@@ -0,0 +1,184 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <common/bl_common.h>
+#include <common/debug.h>
+#include <common/tbbr/tbbr_img_def.h>
+#include <drivers/auth/auth_mod.h>
+#include <drivers/auth/crypto_mod.h>
+#include <lib/utils.h>
+#include <plat/common/platform.h>
+
+#include <imx8m_deferred_auth.h>
+#include <imx_ticks.h>
+#include <platform_def.h>
+
+static struct imx8m_deferred_auth_list deferred;
+
+#if IMAGE_BL2
+/*
+ * OP-TEE is started by BL31, so its pager and paged images are not needed
+ * before then. BL2 runs with the data cache off, BL31 with the data cache on,
+ * which makes hashing them there much cheaper.
+ */
+static bool imx8m_image_auth_deferrable(unsigned int image_id)
+{
+	switch (image_id) {
+	case BL32_EXTRA1_IMAGE_ID:
+	case BL32_EXTRA2_IMAGE_ID:
+		return true;
+	default:
+		return false;
+	}
+}
+
+/*
+ * Record the hash the image must match instead of checking it now. The
+ * certificate holding the hash has already been authenticated. Anything which
+ * cannot be recorded is authenticated right away as usual.
+ */
+int plat_defer_image_auth(unsigned int image_id, image_info_t *image_data)
+{
+	struct imx8m_deferred_auth *entry = NULL;
+	void *hash_ptr;
+	unsigned int hash_len;
+	unsigned int i;
+
+	if (!imx8m_image_auth_deferrable(image_id)) {
+		return -ENOTSUP;
+	}
+
+	if ((auth_mod_get_img_hash(image_id, &hash_ptr, &hash_len) != 0) ||
+	    (hash_len > sizeof(entry->hash))) {
+		return -ENOTSUP;
+	}
+
+	/* The same image may be loaded again from another source */
+	for (i = 0U; i < deferred.count; i++) {
+		if (deferred.images[i].image_id == image_id) {
+			entry = &deferred.images[i];
+			break;
+		}
+	}
+
+	if (entry == NULL) {
+		if (deferred.count == IMX8M_DEFERRED_AUTH_MAX) {
+			return -ENOTSUP;
+		}
+		entry = &deferred.images[deferred.count++];
+	}
+
+	entry->image_id = image_id;
+	entry->image_base = image_data->image_base;
+	entry->image_size = image_data->image_size;
+	entry->hash_len = hash_len;
+	(void)memcpy(entry->hash, hash_ptr, hash_len);
+
+	INFO("BL2: Image id=%u will be authenticated by BL31\n", image_id);
+
+	return 0;
+}
+
+/*
+ * Address of the list to pass to BL31. BL2 runs with the MMU off, so the list
+ * is already in memory and BL31 copies it before it can be overwritten.
+ */
+uintptr_t imx8m_deferred_auth_handoff(void)
+{
+	return (uintptr_t)&deferred;
+}
+#endif /* IMAGE_BL2 */
+
+#if IMAGE_BL31
+/*
+ * Copy the list of images BL2 has left to BL31 to authenticate. BL2 always
+ * passes one, so anything else means the images cannot be trusted.
+ */
+void imx8m_deferred_auth_setup(uintptr_t handoff)
+{
+	const struct imx8m_deferred_auth_list *list = (const void *)handoff;
+
+	if (!is_aligned(handoff, sizeof(uintptr_t)) ||
+	    (handoff < BL2_BASE) || (handoff > (BL2_LIMIT - sizeof(*list))) ||
+	    (list->count > IMX8M_DEFERRED_AUTH_MAX)) {
+		ERROR("BL31: Invalid list of images to authenticate\n");
+		panic();
+	}
+
+	(void)memcpy(&deferred, list, sizeof(deferred));
+}
+
+/* Only hashes are checked in BL31 but the crypto library needs a heap */
+int plat_get_mbedtls_heap(void **heap_addr, size_t *heap_size)
+{
+	return get_mbedtls_heap_helper(heap_addr, heap_size);
+}
+
+static bool imx8m_deferred_image_is_secure(
+		const struct imx8m_deferred_auth *entry)
+{
+	uintptr_t end = entry->image_base + entry->image_size;
+
+	return (entry->image_base >= BL32_BASE) && (end > entry->image_base) &&
+	       (end <= (BL32_BASE + BL32_SIZE)) &&
+	       (entry->hash_len <= sizeof(entry->hash));
+}
+
+/*
+ * Authenticate the images BL2 has left to BL31, with the MMU and data cache
+ * on and before BL32 is started. An image which does not match is wiped and
+ * BL31 stops there.
+ */
+void imx8m_deferred_auth_verify(void)
+{
+	struct imx8m_deferred_auth *entry;
+	uint64_t start;
+	unsigned int i;
+	int rc;
+
+	if (deferred.count == 0U) {
+		return;
+	}
+
+	crypto_mod_init();
+
+	for (i = 0U; i < deferred.count; i++) {
+		entry = &deferred.images[i];
+
+		if (!imx8m_deferred_image_is_secure(entry)) {
+			ERROR("BL31: Image id=%u is outside of BL32 memory\n",
+			      entry->image_id);
+			panic();
+		}
+
+		start = read_cntpct_el0();
+		rc = crypto_mod_verify_hash((void *)entry->image_base,
+					    entry->image_size, entry->hash,
+					    entry->hash_len);
+		if (rc != 0) {
+			ERROR("BL31: Image id=%u failed to authenticate (%i)\n",
+			      entry->image_id, rc);
+			zero_normalmem((void *)entry->image_base,
+				       entry->image_size);
+			flush_dcache_range(entry->image_base,
+					   entry->image_size);
+			panic();
+		}
+
+		INFO("BL31: Image id=%u authenticated in %llu us\n",
+		     entry->image_id, imx_ticks_to_us(read_cntpct_el0() - start));
+	}
+
+	deferred.count = 0U;
+}
+#endif /* IMAGE_BL31 */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited and Contributors. All rights reserved.
  * Copyright (c) 2022, Linaro.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -15,6 +15,8 @@
 #include <libfdt.h>
 #include <platform_def.h>
 
+#include <imx8m_measured_boot.h>
+
 #define DTB_PROP_HW_LOG_ADDR	"tpm_event_log_addr"
 #define DTB_PROP_HW_LOG_SIZE	"tpm_event_log_size"
 
@@ -184,7 +186,7 @@ int imx8m_set_nt_fw_info(size_t log_size, uintptr_t *ns_log_addr)
 
 	assert(ns_log_addr != NULL);
 
-	ns_addr = PLAT_IMX8M_DTO_BASE + PLAT_IMX8M_DTO_MAX_SIZE;
+	ns_addr = IMX8M_NS_EVENT_LOG_BASE;
 
 	imx8m_event_log_fdt_init_overlay(PLAT_IMX8M_DTO_BASE,
 					  PLAT_IMX8M_DTO_MAX_SIZE);
@@ -0,0 +1,262 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <drivers/auth/crypto_mod.h>
+#include <drivers/delay_timer.h>
+#include <lib/mmio.h>
+#include <plat/common/platform.h>
+
+#include <gpc.h>
+#include <imx8m_hash_worker.h>
+#include <imx_ticks.h>
+#include <platform_def.h>
+
+/* The worker runs on the first secondary core */
+#define HASH_WORKER_CORE	U(1)
+
+/* Time the worker has to power up, start and power down again */
+#define HASH_WORKER_PWR_US	U(1000)
+#define HASH_WORKER_START_US	U(10000)
+#define HASH_WORKER_STOP_US	U(10000)
+
+#define WORKER_OFF		U(0)
+#define WORKER_IDLE		U(1)
+#define WORKER_BUSY		U(2)
+#define WORKER_EXIT		U(3)
+
+/*
+ * Mailbox shared with the worker. BL2 runs with the MMU off, so all of these
+ * accesses are Device-nGnRnE and only need barriers between them.
+ */
+static struct {
+	volatile uint32_t state;
+	void *volatile data_ptr;
+	volatile unsigned int data_len;
+	volatile int result;
+	volatile uint64_t hash_ticks;
+} mbox;
+
+/* Timing of the image being loaded, only used by the primary core */
+static struct {
+	bool active;
+	uint64_t start;
+	uint64_t total;
+	uint64_t stall;
+	size_t len;
+} stats;
+
+static bool worker_running;
+
+static void worker_set_state(uint32_t state)
+{
+	dsbsy();
+	mbox.state = state;
+	dsbsy();
+	sev();
+}
+
+/* Runs on the worker, which powers itself down once this returns */
+void imx8m_hash_worker_main(void)
+{
+	uint64_t start;
+	int rc;
+
+	worker_set_state(WORKER_IDLE);
+
+	for (;;) {
+		while (mbox.state == WORKER_IDLE) {
+			wfe();
+		}
+
+		if (mbox.state == WORKER_EXIT) {
+			return;
+		}
+
+		start = read_cntpct_el0();
+		rc = crypto_mod_image_hash_update(mbox.data_ptr,
+						  mbox.data_len);
+		mbox.hash_ticks += read_cntpct_el0() - start;
+		mbox.result = rc;
+
+		worker_set_state(WORKER_IDLE);
+	}
+}
+
+/* Wait for the chunk being hashed, if any, and return the first error */
+static int worker_sync(void)
+{
+	uint64_t start = read_cntpct_el0();
+
+	while (mbox.state == WORKER_BUSY) {
+		wfe();
+	}
+
+	stats.stall += read_cntpct_el0() - start;
+
+	return mbox.result;
+}
+
+int plat_image_hash_update(void *data_ptr, unsigned int data_len)
+{
+	int rc;
+
+	if (!worker_running) {
+		return crypto_mod_image_hash_update(data_ptr, data_len);
+	}
+
+	if (!stats.active) {
+		stats.active = true;
+		stats.start = read_cntpct_el0();
+		stats.stall = 0U;
+		stats.len = 0U;
+		mbox.hash_ticks = 0U;
+	}
+
+	/* Only one chunk is handed over at a time */
+	rc = worker_sync();
+	if (rc != 0) {
+		return rc;
+	}
+
+	mbox.data_ptr = data_ptr;
+	mbox.data_len = data_len;
+	worker_set_state(WORKER_BUSY);
+
+	stats.len += data_len;
+
+	return 0;
+}
+
+int plat_image_hash_wait(void)
+{
+	int rc;
+
+	if (!worker_running) {
+		return 0;
+	}
+
+	rc = worker_sync();
+	mbox.result = 0;
+
+	stats.total = read_cntpct_el0() - stats.start;
+	stats.active = false;
+
+	return rc;
+}
+
+/*
+ * Print how long the last image took to load and to hash, and for how long
+ * the primary core had to wait for the hashing to catch up.
+ */
+void imx8m_hash_worker_report(unsigned int image_id)
+{
+	if (!worker_running || (stats.len == 0U)) {
+		return;
+	}
+
+	INFO("BL2: Image id=%u: %lu KiB, load %llu us, hash %llu us, stalled %llu us\n",
+	     image_id, (unsigned long)(stats.len >> 10),
+	     imx_ticks_to_us(stats.total - stats.stall),
+	     imx_ticks_to_us(mbox.hash_ticks), imx_ticks_to_us(stats.stall));
+
+	stats.len = 0U;
+}
+
+/*
+ * Power up the worker core. This is the same sequence as imx_set_cpu_pwr_on()
+ * without the bakery lock, which BL2 does not have and does not need as no
+ * other core is running. A core which does not power up is left in reset, as
+ * it was before.
+ */
+int imx8m_hash_worker_start(void)
+{
+	uint64_t entry = (uintptr_t)&imx8m_hash_worker_entrypoint >> 2;
+	unsigned int core = HASH_WORKER_CORE;
+	uint64_t timeout;
+
+	mbox.state = WORKER_OFF;
+	dsbsy();
+
+	mmio_write_32(IMX_SRC_BASE + SRC_GPR1_OFFSET + (core << 3),
+		      (uint32_t)(entry >> 22) & 0xffff);
+	mmio_write_32(IMX_SRC_BASE + SRC_GPR1_OFFSET + (core << 3) + 4,
+		      (uint32_t)entry & 0x003fffff);
+
+	mmio_clrbits_32(IMX_GPC_BASE + LPCR_A53_AD, COREx_WFI_PDN(core));
+	mmio_clrbits_32(IMX_SRC_BASE + SRC_A53RCR1, (1 << core));
+	mmio_setbits_32(IMX_GPC_BASE + COREx_PGC_PCR(core), 0x1);
+	mmio_setbits_32(IMX_GPC_BASE + CPU_PGC_UP_TRG, (1 << core));
+
+	timeout = timeout_init_us(HASH_WORKER_PWR_US);
+	while ((mmio_read_32(IMX_GPC_BASE + CPU_PGC_UP_TRG) & (1 << core)) != 0) {
+		if (timeout_elapsed(timeout)) {
+			mmio_clrbits_32(IMX_GPC_BASE + CPU_PGC_UP_TRG, (1 << core));
+			mmio_clrbits_32(IMX_GPC_BASE + COREx_PGC_PCR(core), 0x1);
+			WARN("BL2: Hash worker did not power up\n");
+			return -ETIMEDOUT;
+		}
+	}
+	mmio_clrbits_32(IMX_GPC_BASE + COREx_PGC_PCR(core), 0x1);
+	mmio_setbits_32(IMX_SRC_BASE + SRC_A53RCR1, (1 << core));
+
+	timeout = timeout_init_us(HASH_WORKER_START_US);
+	while (mbox.state != WORKER_IDLE) {
+		if (timeout_elapsed(timeout)) {
+			WARN("BL2: Hash worker did not start\n");
+			return -ETIMEDOUT;
+		}
+	}
+
+	worker_running = true;
+
+	INFO("BL2: Hashing images on core %u\n", core);
+
+	return 0;
+}
+
+/*
+ * Power the worker core down before leaving BL2 so that BL31 finds it off,
+ * as PSCI expects. This mirrors imx_set_cpu_pwr_off(), then waits for the GPC
+ * to report the core powered down. A core which does not power down is held
+ * in reset instead, which CPU_ON copes with just as well.
+ */
+void imx8m_hash_worker_stop(void)
+{
+	unsigned int core = HASH_WORKER_CORE;
+	uint64_t timeout;
+
+	if (!worker_running) {
+		return;
+	}
+
+	(void)worker_sync();
+
+	/* Clear the status of any earlier power down of the core */
+	mmio_write_32(IMX_GPC_BASE + COREx_PGC_SR(core), PGC_SR_PSR);
+
+	mmio_setbits_32(IMX_GPC_BASE + LPCR_A53_AD, COREx_WFI_PDN(core));
+	mmio_setbits_32(IMX_GPC_BASE + COREx_PGC_PCR(core), 0x1);
+
+	worker_set_state(WORKER_EXIT);
+
+	timeout = timeout_init_us(HASH_WORKER_STOP_US);
+	while ((mmio_read_32(IMX_GPC_BASE + COREx_PGC_SR(core)) &
+		PGC_SR_PSR) == 0U) {
+		if (timeout_elapsed(timeout)) {
+			WARN("BL2: Hash worker did not power down\n");
+			mmio_clrbits_32(IMX_SRC_BASE + SRC_A53RCR1, (1 << core));
+			break;
+		}
+	}
+
+	worker_running = false;
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <arch_helpers.h>
+#include <common/bl_common.h>
+#include <common/debug.h>
+#include <common/desc_image_load.h>
+#include <common/image_decompress.h>
+#include <common/tbbr/tbbr_img_def.h>
+#include <lib/cassert.h>
+#include <tf_gunzip.h>
+
+#include <imx8m_image_decompress.h>
+#include <imx_ticks.h>
+#include <platform_def.h>
+
+#define IMX_DECOMP_BUF_END	(IMX_DECOMP_BUF_BASE + IMX_DECOMP_BUF_SIZE)
+
+/* The buffer must lie in DRAM and not overlap any image BL2 inflates into */
+CASSERT((IMX_DECOMP_BUF_BASE >= IMX_DRAM_BASE) &&
+	((IMX_DECOMP_BUF_END - IMX_DRAM_BASE) <= IMX_DRAM_SIZE),
+	assert_imx8m_decomp_buf_outside_dram);
+CASSERT((IMX_DECOMP_BUF_END <= BL32_BASE) ||
+	(IMX_DECOMP_BUF_BASE >= (BL32_BASE + BL32_SIZE)),
+	assert_imx8m_decomp_buf_overlaps_bl32);
+CASSERT((IMX_DECOMP_BUF_END <= PLAT_NS_IMAGE_OFFSET) ||
+	(IMX_DECOMP_BUF_BASE >= (PLAT_NS_IMAGE_OFFSET + PLAT_NS_IMAGE_SIZE)),
+	assert_imx8m_decomp_buf_overlaps_bl33);
+
+static bool imx8m_image_is_compressed(unsigned int image_id)
+{
+	bl_mem_params_node_t *bl_mem_params = get_bl_mem_params_node(image_id);
+
+	switch (image_id) {
+	case BL32_IMAGE_ID:
+	case BL32_EXTRA1_IMAGE_ID:
+	case BL32_EXTRA2_IMAGE_ID:
+	case BL33_IMAGE_ID:
+		break;
+	default:
+		return false;
+	}
+
+	return (bl_mem_params != NULL) &&
+	       ((bl_mem_params->image_info.h.attr &
+		 IMAGE_ATTRIB_SKIP_LOADING) == 0U);
+}
+
+void imx8m_image_decompress_init(void)
+{
+	image_decompress_init(IMX_DECOMP_BUF_BASE, IMX_DECOMP_BUF_SIZE,
+			      gunzip);
+}
+
+/*
+ * Have the compressed image loaded into the decompression buffer instead of
+ * its final location.
+ */
+void imx8m_image_decompress_prepare(unsigned int image_id)
+{
+	if (imx8m_image_is_compressed(image_id)) {
+		image_decompress_prepare(
+			&get_bl_mem_params_node(image_id)->image_info);
+	}
+}
+
+/*
+ * Inflate the image which has just been loaded, authenticated and measured
+ * into its final location.
+ */
+int imx8m_image_decompress(unsigned int image_id)
+{
+	image_info_t *image_info;
+	uint32_t compressed_size;
+	uint64_t start;
+	int ret;
+
+	if (!imx8m_image_is_compressed(image_id)) {
+		return 0;
+	}
+
+	image_info = &get_bl_mem_params_node(image_id)->image_info;
+	compressed_size = image_info->image_size;
+
+	start = read_cntpct_el0();
+	ret = image_decompress(image_info);
+	if (ret != 0) {
+		return ret;
+	}
+
+	INFO("BL2: Image id=%u: read %u KiB, inflated to %u KiB in %llu us\n",
+	     image_id, compressed_size >> 10, image_info->image_size >> 10,
+	     imx_ticks_to_us(read_cntpct_el0() - start));
+
+	return 0;
+}
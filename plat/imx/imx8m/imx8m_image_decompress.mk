@@ -0,0 +1,29 @@
+#
+# Copyright 2026 NXP
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+# Store BL32 and BL33 gzip compressed in the FIP and inflate them in BL2
+FIP_GZIP		?=	0
+$(eval $(call assert_boolean,FIP_GZIP))
+$(eval $(call add_define,FIP_GZIP))
+
+ifeq (${FIP_GZIP},1)
+ifneq (${NEED_BL2},yes)
+    $(error "FIP_GZIP requires NEED_BL2=yes")
+endif
+
+# The Cortex-A53 implements the optional Armv8.0 CRC32 instructions
+ZLIB_HW_CRC32		?=	1
+include lib/zlib/zlib.mk
+
+BL2_SOURCES		+=	common/image_decompress.c			\
+				plat/imx/imx8m/imx8m_image_decompress.c		\
+				$(ZLIB_SOURCES)
+
+BL32_PRE_TOOL_FILTER	:=	GZIP
+BL32_EXTRA1_PRE_TOOL_FILTER :=	GZIP
+BL32_EXTRA2_PRE_TOOL_FILTER :=	GZIP
+BL33_PRE_TOOL_FILTER	:=	GZIP
+endif
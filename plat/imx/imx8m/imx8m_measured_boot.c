@@ -5,15 +5,27 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
-#include <string.h>
+#include <assert.h>
 
 #include "./include/imx8m_measured_boot.h"
 #include <drivers/measured_boot/event_log/event_log.h>
 #include <drivers/measured_boot/metadata.h>
+#include <lib/cassert.h>
 #include <plat/arm/common/plat_arm.h>
 
-/* Event Log data */
-static uint8_t event_log[PLAT_IMX_EVENT_LOG_MAX_SIZE];
+/*
+ * The Event Log is built directly in Non-secure memory, where BL33 finds it.
+ * BL2 runs with the MMU and the caches off, so it does not need to be copied
+ * or flushed there once complete.
+ */
+static uint8_t *const event_log = (uint8_t *)IMX8M_NS_EVENT_LOG_BASE;
+
+/* Images are loaded while the Event Log is built, so must not overlap it */
+CASSERT(((PLAT_NS_IMAGE_OFFSET + PLAT_NS_IMAGE_SIZE) <=
+	 IMX8M_NS_EVENT_LOG_BASE) ||
+	(PLAT_NS_IMAGE_OFFSET >=
+	 (IMX8M_NS_EVENT_LOG_BASE + PLAT_IMX_EVENT_LOG_MAX_SIZE)),
+	assert_imx8m_event_log_overlaps_bl33);
 
 /* FVP table with platform specific image IDs, names and PCRs */
 static const event_log_metadata_t imx8m_event_log_metadata[] = {
@@ -43,7 +55,8 @@ int plat_mboot_measure_image(unsigned int image_id, image_info_t *image_data)
 
 void bl2_plat_mboot_init(void)
 {
-	event_log_init(event_log, event_log + sizeof(event_log));
+	event_log_init(event_log, event_log + PLAT_IMX_EVENT_LOG_MAX_SIZE);
+	(void)event_log_index_metadata(imx8m_event_log_metadata);
 	event_log_write_header();
 }
 
@@ -71,12 +84,8 @@ void bl2_plat_mboot_finish(void)
 		panic();
 	}
 
-	/* Copy Event Log to Non-secure memory */
-	(void)memcpy((void *)ns_log_addr, (const void *)event_log,
-		     event_log_cur_size);
-
-	/* Ensure that the Event Log is visible in Non-secure memory */
-	flush_dcache_range(ns_log_addr, event_log_cur_size);
+	/* The Event Log is already in place */
+	assert(ns_log_addr == (uintptr_t)event_log);
 
 	dump_event_log((uint8_t *)event_log, event_log_cur_size);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -16,6 +16,7 @@
 #include <dram.h>
 #include <gpc.h>
 #include <imx8m_psci.h>
+#include <imx_telemetry.h>
 #include <plat_imx8.h>
 
 /*
@@ -41,20 +42,29 @@ int imx_validate_ns_entrypoint(uintptr_t ns_entrypoint)
 int imx_pwr_domain_on(u_register_t mpidr)
 {
 	unsigned int core_id;
-	uint64_t base_addr = BL31_START;
 
 	core_id = MPIDR_AFFLVL0_VAL(mpidr);
 
-	imx_set_cpu_secure_entry(core_id, base_addr);
-	imx_set_cpu_pwr_on(core_id);
+	imx_telem_cpu_on_request(core_id);
+
+	if (imx_set_cpu_pwr_on(core_id) != 0) {
+		imx_telem_inc(IMX_TELEM_CPU_ON_FAILS);
+		return PSCI_E_INTERN_FAIL;
+	}
 
 	return PSCI_E_SUCCESS;
 }
 
 void imx_pwr_domain_on_finish(const psci_power_state_t *target_state)
 {
+	uint64_t telem_start = imx_telem_now();
+
 	plat_gic_pcpu_init();
 	plat_gic_cpuif_enable();
+
+	dram_gov_cpu_on();
+
+	imx_telem_cpu_on_done(telem_start);
 }
 
 void imx_pwr_domain_off(const psci_power_state_t *target_state)
@@ -62,6 +72,10 @@ void imx_pwr_domain_off(const psci_power_state_t *target_state)
 	uint64_t mpidr = read_mpidr_el1();
 	unsigned int core_id = MPIDR_AFFLVL0_VAL(mpidr);
 
+	imx_telem_inc(IMX_TELEM_PSCI_CPU_OFF);
+
+	dram_gov_cpu_off();
+
 	plat_gic_cpuif_disable();
 	imx_set_cpu_pwr_off(core_id);
 }
@@ -103,11 +117,13 @@ void imx_cpu_standby(plat_local_state_t cpu_state)
 
 void imx_domain_suspend(const psci_power_state_t *target_state)
 {
+	uint64_t telem_start = imx_telem_now();
 	uint64_t base_addr = BL31_START;
 	uint64_t mpidr = read_mpidr_el1();
 	unsigned int core_id = MPIDR_AFFLVL0_VAL(mpidr);
 
 	if (is_local_state_off(CORE_PWR_STATE(target_state))) {
+		dram_gov_cpu_off();
 		plat_gic_cpuif_disable();
 		imx_set_cpu_secure_entry(core_id, base_addr);
 		imx_set_cpu_lpm(core_id, true);
@@ -120,7 +136,12 @@ void imx_domain_suspend(const psci_power_state_t *target_state)
 	if (!is_local_state_run(CLUSTER_PWR_STATE(target_state)))
 		imx_set_cluster_powerdown(core_id, CLUSTER_PWR_STATE(target_state));
 
+	/* The telemetry is in DDR, which goes into retention below */
+	imx_telem_suspend_enter(telem_start);
+
 	if (is_local_state_off(SYSTEM_PWR_STATE(target_state))) {
+		dram_gov_suspend();
+
 		if (!imx_m4_lpa_active()) {
 			imx_set_sys_lpm(core_id, true);
 			dram_enter_retention();
@@ -138,6 +159,7 @@ void imx_domain_suspend(const psci_power_state_t *target_state)
 
 void imx_domain_suspend_finish(const psci_power_state_t *target_state)
 {
+	uint64_t telem_start = imx_telem_now();
 	uint64_t mpidr = read_mpidr_el1();
 	unsigned int core_id = MPIDR_AFFLVL0_VAL(mpidr);
 
@@ -164,10 +186,13 @@ void imx_domain_suspend_finish(const psci_power_state_t *target_state)
 	if (is_local_state_off(CORE_PWR_STATE(target_state))) {
 		imx_set_cpu_lpm(core_id, false);
 		plat_gic_cpuif_enable();
+		dram_gov_cpu_on();
 	} else {
 		write_scr_el3(read_scr_el3() & (~SCR_FIQ_BIT));
 		isb();
 	}
+
+	imx_telem_suspend_exit(telem_start);
 }
 
 void imx_get_sys_suspend_power_state(psci_power_state_t *req_state)
@@ -0,0 +1,39 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <drivers/console.h>
+#include <drivers/ring_console.h>
+
+#include <imx8m_ring_console.h>
+#include <imx_uart.h>
+#include <platform_def.h>
+
+static console_ring_t ring_console;
+
+/*
+ * Log to the DRAM at IMX_RING_CONSOLE_BASE instead of the boot UART, which is
+ * then only written to when its FIFO has room, or when the console is flushed.
+ */
+void imx8m_ring_console_init(console_t *uart)
+{
+	(void)console_unregister(uart);
+	(void)console_ring_register(IMX_RING_CONSOLE_BASE,
+				    IMX_RING_CONSOLE_SIZE, &ring_console);
+#if IMX_RING_CONSOLE_UART
+	console_ring_set_uart(&ring_console, uart, console_imx_uart_try_putc);
+#endif
+}
+
+#if IMAGE_BL31
+/*
+ * The UART belongs to the normal world once BL31 has booted, so runtime logs
+ * are only kept in memory.
+ */
+void imx8m_ring_console_runtime(void)
+{
+	console_ring_set_uart(&ring_console, NULL, NULL);
+}
+#endif /* IMAGE_BL31 */
@@ -21,6 +21,10 @@
 #include <stdbool.h>
 #include <tbbr_img_def.h>
 
+#include <imx8m_hash_worker.h>
+#include <imx8m_deferred_auth.h>
+#include <imx8m_image_decompress.h>
+#include <imx8m_ring_console.h>
 #include <imx_aipstz.h>
 #include <imx_csu.h>
 #include <imx_uart.h>
@@ -79,6 +83,9 @@ void bl2_el3_early_platform_setup(u_register_t arg1, u_register_t arg2,
 
 	console_imx_uart_register(IMX_BOOT_UART_BASE, IMX_BOOT_UART_CLK_IN_HZ,
 		IMX_CONSOLE_BAUDRATE, &console);
+#if IMX_RING_CONSOLE
+	imx8m_ring_console_init(&console);
+#endif
 
 	generic_delay_timer_init();
 
@@ -97,8 +104,32 @@ void bl2_el3_plat_arch_setup(void)
 
 void bl2_platform_setup(void)
 {
+#if FIP_GZIP
+	imx8m_image_decompress_init();
+#endif
+
+#if IMX_BL2_HASH_WORKER
+	/* Images are hashed synchronously if the worker fails to start */
+	(void)imx8m_hash_worker_start();
+#endif
 }
 
+#if IMX_BL2_HASH_WORKER
+void bl2_el3_plat_prepare_exit(void)
+{
+	imx8m_hash_worker_stop();
+}
+#endif
+
+#if FIP_GZIP
+int bl2_plat_handle_pre_image_load(unsigned int image_id)
+{
+	imx8m_image_decompress_prepare(image_id);
+
+	return 0;
+}
+#endif
+
 int bl2_plat_handle_post_image_load(unsigned int image_id)
 {
 	int err = 0;
@@ -108,7 +139,25 @@ int bl2_plat_handle_post_image_load(unsigned int image_id)
 
 	assert(bl_mem_params);
 
+#if IMX_BL2_HASH_WORKER
+	imx8m_hash_worker_report(image_id);
+#endif
+
+#if FIP_GZIP
+	err = imx8m_image_decompress(image_id);
+	if (err != 0) {
+		return err;
+	}
+#endif
+
 	switch (image_id) {
+#if IMX_DEFERRED_AUTH
+	case BL31_IMAGE_ID:
+		/* Tell BL31 which images it has to authenticate */
+		bl_mem_params->ep_info.args.arg1 =
+			imx8m_deferred_auth_handoff();
+		break;
+#endif
 	case BL32_IMAGE_ID:
 		pager_mem_params = get_bl_mem_params_node(BL32_EXTRA1_IMAGE_ID);
 		assert(pager_mem_params);
@@ -103,6 +103,9 @@ ifneq ($(BL2),)
 RESET_TO_BL31		:=	0
 $(eval $(call TOOL_ADD_PAYLOAD,${BUILD_PLAT}/tb_fw.crt,--tb-fw-cert))
 endif
+
+include plat/imx/imx8m/imx8m_image_decompress.mk
+
 ifneq ($(BL32_EXTRA1),)
 $(eval $(call TOOL_ADD_IMG,BL32_EXTRA1,--tos-fw-extra1))
 endif
@@ -157,11 +160,54 @@ $(ROTPK_HASH): $(ROT_KEY) | $$(@D)/
 	${OPENSSL_BIN_PATH}/openssl dgst -sha256 -binary > $@ 2>/dev/null
 endif
 
+# Have BL31 rather than BL2 authenticate the OP-TEE pager and paged images
+IMX_DEFERRED_AUTH	?=	0
+$(eval $(call assert_boolean,IMX_DEFERRED_AUTH))
+$(eval $(call add_define,IMX_DEFERRED_AUTH))
+
+ifeq (${IMX_DEFERRED_AUTH},1)
+ifneq (${TRUSTED_BOARD_BOOT},1)
+    $(error "IMX_DEFERRED_AUTH requires TRUSTED_BOARD_BOOT=1")
+endif
+ifneq (${NEED_BL2},yes)
+    $(error "IMX_DEFERRED_AUTH requires NEED_BL2=yes")
+endif
+ifneq (${SPD},opteed)
+    $(error "IMX_DEFERRED_AUTH requires SPD=opteed")
+endif
+ifeq (${FIP_GZIP},1)
+    $(error "IMX_DEFERRED_AUTH cannot be used with FIP_GZIP=1")
+endif
+ifeq (${MEASURED_BOOT},1)
+    $(error "IMX_DEFERRED_AUTH cannot be used with MEASURED_BOOT=1")
+endif
+ifeq (${PSA_CRYPTO},1)
+    $(error "IMX_DEFERRED_AUTH cannot be used with PSA_CRYPTO=1")
+endif
+BL2_SOURCES		+=	plat/imx/imx8m/imx8m_deferred_auth.c
+# BL31 only matches the images against their digests: leave the certificate
+# parser and the signature verification out of it, to fit in its 128K region
+BL31_SOURCES		+=	drivers/auth/crypto_mod.c			\
+				plat/imx/imx8m/imx8m_deferred_auth.c		\
+				$(filter-out drivers/auth/mbedtls/mbedtls_x509_parser.c,${MBEDTLS_SOURCES})
+BL31_CFLAGS		+=	-DCRYPTO_VERIFY_HASH_ONLY=1
+endif
+
 ENABLE_PIE		:=	1
 USE_COHERENT_MEM	:=	1
+XLAT_TABLES_MERGE_REGIONS :=	1
 RESET_TO_BL31		:=	1
 A53_DISABLE_NON_TEMPORAL_HINT := 0
 
+# Use the optimised AArch64 string routines from libc_asm
+OVERRIDE_LIBC		:=	1
+ifeq (${OVERRIDE_LIBC},1)
+    include lib/libc/libc_asm.mk
+endif
+
+# Serve the trivial SiP queries from the leaf SMC fast path
+SMC_LEAF_FASTPATH	:=	1
+
 ERRATA_A53_835769	:=	1
 ERRATA_A53_843419	:=	1
 ERRATA_A53_855873	:=	1
@@ -174,6 +220,23 @@ ifeq (${IMX_DRAM_RETENTION},1)
 BL31_SOURCES		+=	${IMX_DRAM_SOURCES}
 endif
 
+# Let BL31 scale the DDR frequency with the load of the DDR controller
+IMX_DDR_GOVERNOR	?=	0
+$(eval $(call assert_boolean,IMX_DDR_GOVERNOR))
+$(eval $(call add_define,IMX_DDR_GOVERNOR))
+
+ifeq (${IMX_DDR_GOVERNOR},1)
+ifneq (${IMX_DRAM_RETENTION},1)
+    $(error "IMX_DDR_GOVERNOR requires IMX_DRAM_RETENTION=1")
+endif
+ifeq (${SPD},trusty)
+    $(error "IMX_DDR_GOVERNOR cannot be used with SPD=trusty")
+endif
+IMX_DDR_GOV_PERIOD_MS	?=	50
+$(eval $(call add_define,IMX_DDR_GOV_PERIOD_MS))
+BL31_SOURCES		+=	plat/imx/imx8m/ddr/dram_gov.c
+endif
+
 ifneq (${PRELOADED_BL33_BASE},)
 $(eval $(call add_define_val,PLAT_NS_IMAGE_OFFSET,${PRELOADED_BL33_BASE}))
 endif
@@ -190,6 +253,49 @@ ifeq (${IMX_BOOT_UART_BASE},auto)
 endif
 $(eval $(call add_define,IMX_BOOT_UART_BASE))
 
+# Log to a ring buffer in DRAM, which is drained into the boot UART
+IMX_RING_CONSOLE	?=	0
+$(eval $(call assert_boolean,IMX_RING_CONSOLE))
+$(eval $(call add_define,IMX_RING_CONSOLE))
+
+ifeq (${IMX_RING_CONSOLE},1)
+IMX_RING_CONSOLE_BASE	?=	0xbdff0000
+IMX_RING_CONSOLE_SIZE	?=	0x10000
+IMX_RING_CONSOLE_UART	?=	1
+$(eval $(call assert_boolean,IMX_RING_CONSOLE_UART))
+$(eval $(call add_define,IMX_RING_CONSOLE_BASE))
+$(eval $(call add_define,IMX_RING_CONSOLE_SIZE))
+$(eval $(call add_define,IMX_RING_CONSOLE_UART))
+
+BL2_SOURCES		+=	drivers/console/ring_console.c			\
+				plat/imx/imx8m/imx8m_ring_console.c
+BL31_SOURCES		+=	drivers/console/ring_console.c			\
+				plat/imx/imx8m/imx8m_ring_console.c
+endif
+
+# Per-core EL3 counters in a DRAM region readable from the normal world
+IMX_TELEMETRY		?=	0
+$(eval $(call assert_boolean,IMX_TELEMETRY))
+$(eval $(call add_define,IMX_TELEMETRY))
+
+ifeq (${IMX_TELEMETRY},1)
+IMX_TELEMETRY_BASE	?=	0xbdfef000
+IMX_TELEMETRY_SIZE	?=	0x1000
+$(eval $(call add_define,IMX_TELEMETRY_BASE))
+$(eval $(call add_define,IMX_TELEMETRY_SIZE))
+endif
+
+# Text stats files, e.g. #S/psci, for the debugfs SMC interface
+ifeq (${USE_DEBUGFS},1)
+BL31_CFLAGS		+=	-DPLAT_XLAT_TABLES_DYNAMIC=1
+BL31_SOURCES		+=	plat/imx/common/imx_debugfs.c
+endif
+
+ifneq ($(filter 1,${IMX_TELEMETRY} ${USE_DEBUGFS}),)
+BL31_CFLAGS		+=	-DIMX_TELEM_HOOKS=1
+BL31_SOURCES		+=	plat/imx/common/imx_telemetry.c
+endif
+
 EL3_EXCEPTION_HANDLING := $(SDEI_SUPPORT)
 ifeq (${SDEI_SUPPORT}, 1)
 BL31_SOURCES 		+= 	plat/imx/common/imx_ehf.c	\
@@ -206,6 +312,22 @@ BL2_SOURCES		+=	plat/imx/imx8m/imx8m_measured_boot.c	\
 				${EVENT_LOG_SOURCES}
 endif
 
+# Hash the images loaded by BL2 on a secondary core
+IMX_BL2_HASH_WORKER	?=	0
+$(eval $(call assert_boolean,IMX_BL2_HASH_WORKER))
+$(eval $(call add_define,IMX_BL2_HASH_WORKER))
+
+ifeq (${IMX_BL2_HASH_WORKER},1)
+ifneq (${NEED_BL2},yes)
+    $(error "IMX_BL2_HASH_WORKER requires NEED_BL2=yes")
+endif
+ifneq (${IMAGE_HASH_ON_LOAD},1)
+    $(error "IMX_BL2_HASH_WORKER requires IMAGE_HASH_ON_LOAD=1")
+endif
+BL2_SOURCES		+=	plat/imx/imx8m/imx8m_hash_worker.c	\
+				plat/imx/imx8m/imx8m_hash_worker_entry.S
+endif
+
 $(eval $(call add_define,IMX8M_DDR4_DVFS))
 
 ifeq (${SPD},trusty)
@@ -244,4 +244,6 @@ void imx_gpc_init(void)
 	 * only need to do it once.
 	 */
 	mmio_clrbits_32(IMX_SRC_BASE + SRC_OTG1PHY_SCR, 0x1);
+
+	imx_gpc_cpu_pwr_init();
 }
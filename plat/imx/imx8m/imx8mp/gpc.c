@@ -459,4 +459,6 @@ void imx_gpc_init(void)
 	//GIC
 	mmio_write_32 (0x32700108, 0x80000303);
 	mmio_write_32 (0x3270010c, 0x0);
+
+	imx_gpc_cpu_pwr_init();
 }
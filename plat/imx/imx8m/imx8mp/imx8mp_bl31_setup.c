@@ -14,6 +14,8 @@
 #include <drivers/arm/tzc380.h>
 #include <drivers/console.h>
 #include <drivers/generic_delay_timer.h>
+#include <lib/debugfs.h>
+#include <lib/cassert.h>
 #include <lib/el3_runtime/context_mgmt.h>
 #include <lib/mmio.h>
 #include <lib/xlat_tables/xlat_tables_v2.h>
@@ -24,9 +26,12 @@
 #include <imx_aipstz.h>
 #include <imx_uart.h>
 #include <imx_rdc.h>
+#include <imx_telemetry.h>
 #include <imx8m_caam.h>
 #include <imx8m_ccm.h>
 #include <imx8m_csu.h>
+#include <imx8m_deferred_auth.h>
+#include <imx8m_ring_console.h>
 #include <imx8m_snvs.h>
 #include <platform_def.h>
 #include <plat_common.h>
@@ -274,6 +279,9 @@ void bl31_early_platform_setup2(u_register_t arg0, u_register_t arg1,
 		IMX_CONSOLE_BAUDRATE, &console);
 	/* This console is only used for boot stage */
 	console_set_scope(&console, CONSOLE_FLAG_BOOT);
+#if IMX_RING_CONSOLE
+	imx8m_ring_console_init(&console);
+#endif
 
 	imx8m_caam_init();
 
@@ -320,6 +328,10 @@ void bl31_early_platform_setup2(u_register_t arg0, u_register_t arg1,
 
 	bl31_tzc380_setup();
 
+#if IMX_DEFERRED_AUTH
+	imx8m_deferred_auth_setup(arg1);
+#endif
+
 #if defined (CSU_RDC_TEST)
 	csu_rdc_test(console_base);
 #endif
@@ -335,6 +347,24 @@ void bl31_early_platform_setup2(u_register_t arg0, u_register_t arg1,
 #define MAP_BL32_TOTAL										   \
 	MAP_REGION_FLAT(BL32_BASE, BL32_SIZE, MT_MEMORY | MT_RW)
 
+/* The non-secure regions BL31 shares must not overlap BL32 or each other */
+#if IMX_RING_CONSOLE
+CASSERT(((IMX_RING_CONSOLE_BASE + IMX_RING_CONSOLE_SIZE) <= BL32_BASE) ||
+	(IMX_RING_CONSOLE_BASE >= (BL32_BASE + BL32_SIZE)),
+	assert_imx_ring_console_overlaps_bl32);
+#endif
+#if IMX_TELEMETRY
+CASSERT(((IMX_TELEMETRY_BASE + IMX_TELEMETRY_SIZE) <= BL32_BASE) ||
+	(IMX_TELEMETRY_BASE >= (BL32_BASE + BL32_SIZE)),
+	assert_imx_telemetry_overlaps_bl32);
+#endif
+#if IMX_RING_CONSOLE && IMX_TELEMETRY
+CASSERT(((IMX_TELEMETRY_BASE + IMX_TELEMETRY_SIZE) <=
+	 IMX_RING_CONSOLE_BASE) ||
+	(IMX_TELEMETRY_BASE >= (IMX_RING_CONSOLE_BASE + IMX_RING_CONSOLE_SIZE)),
+	assert_imx_telemetry_overlaps_ring_console);
+#endif
+
 void bl31_plat_arch_setup(void)
 {
 	const mmap_region_t bl_regions[] = {
@@ -346,6 +376,14 @@ void bl31_plat_arch_setup(void)
 #if defined(SPD_opteed) || defined(SPD_trusty)
 		/* Map TEE memory */
 		MAP_BL32_TOTAL,
+#endif
+#if IMX_RING_CONSOLE && defined(PLAT_XLAT_TABLES_DYNAMIC)
+		MAP_REGION_FLAT(IMX_RING_CONSOLE_BASE, IMX_RING_CONSOLE_SIZE,
+				MT_MEMORY | MT_RW | MT_NS),
+#endif
+#if IMX_TELEMETRY && defined(PLAT_XLAT_TABLES_DYNAMIC)
+		MAP_REGION_FLAT(IMX_TELEMETRY_BASE, IMX_TELEMETRY_SIZE,
+				MT_MEMORY | MT_RW | MT_NS),
 #endif
 		{0}
 	};
@@ -362,6 +400,11 @@ void bl31_platform_setup(void)
 
 	generic_delay_timer_init();
 
+	imx_telem_init();
+#if USE_DEBUGFS
+	debugfs_init();
+#endif
+
 	/* select the CKIL source to 32K OSC */
 	mmio_write_32(IMX_ANAMIX_BASE + ANAMIX_MISC_CTL, 0x1);
 
@@ -373,6 +416,14 @@ void bl31_platform_setup(void)
 
 	imx_gpc_init();
 
+	/* Once the GIC is up for the governor timer */
+	dram_gov_init();
+
+#if IMX_DEFERRED_AUTH
+	/* Before BL32 is started by its dispatcher */
+	imx8m_deferred_auth_verify();
+#endif
+
 	/* Enable and reset M7 */
 	mmio_setbits_32(IMX_SRC_BASE + 0xc,  SRC_SCR_M4_ENABLE_MASK);
 	mmio_clrbits_32(IMX_SRC_BASE + 0xc, SRC_SCR_M4C_NON_SCLR_RST_MASK);
@@ -398,6 +449,13 @@ entry_point_info_t *bl31_plat_get_next_image_ep_info(unsigned int type)
 	return NULL;
 }
 
+#if IMX_RING_CONSOLE
+void bl31_plat_runtime_setup(void)
+{
+	imx8m_ring_console_runtime();
+}
+#endif
+
 unsigned int plat_get_syscnt_freq2(void)
 {
 	return COUNTER_FREQUENCY;
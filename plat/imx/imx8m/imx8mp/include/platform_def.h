@@ -48,6 +48,16 @@
 /* Define FIP image location on eMMC */
 #define IMX_FIP_MMC_BASE		U(0x100000)
 
+/*
+ * Buffer the compressed images are loaded into before being inflated. It is
+ * only used while BL2 runs, so it must stay clear of the images BL2 loads but
+ * may be reused by BL33 afterwards.
+ */
+#ifndef IMX_DECOMP_BUF_BASE
+#define IMX_DECOMP_BUF_BASE		U(0x48000000)
+#endif
+#define IMX_DECOMP_BUF_SIZE		U(0x02000000)
+
 #define PLAT_IMX8MP_BOOT_MMC_BASE	U(0x30B50000) /* SD */
 #else
 #define BL31_BASE			U(0x970000)
@@ -76,12 +86,49 @@
 #define PLAT_VIRT_ADDR_SPACE_SIZE	(ULL(1) << 34)
 #define PLAT_PHY_ADDR_SPACE_SIZE	(ULL(1) << 34)
 
+#if USE_DEBUGFS
+/* The debugfs shared buffer is mapped at run time, with its own tables */
+#define IMX_DEBUGFS_MMAP_REGIONS	1
+#define IMX_DEBUGFS_XLAT_TABLES		2
+#else
+#define IMX_DEBUGFS_MMAP_REGIONS	0
+#define IMX_DEBUGFS_XLAT_TABLES		0
+#endif
+
+/*
+ * With USE_DEBUGFS, DRAM is no longer mapped as a whole, so the ring console
+ * and the telemetry page in DRAM need a region and their own tables.
+ */
+#if IMX_RING_CONSOLE && USE_DEBUGFS
+#define IMX_RING_CONSOLE_MMAP_REGIONS	1
+#define IMX_RING_CONSOLE_XLAT_TABLES	2
+#else
+#define IMX_RING_CONSOLE_MMAP_REGIONS	0
+#define IMX_RING_CONSOLE_XLAT_TABLES	0
+#endif
+
+#if IMX_TELEMETRY && USE_DEBUGFS
+#define IMX_TELEM_MMAP_REGIONS		1
+#define IMX_TELEM_XLAT_TABLES		2
+#else
+#define IMX_TELEM_MMAP_REGIONS		0
+#define IMX_TELEM_XLAT_TABLES		0
+#endif
+
 #ifdef SPD_trusty
-#define MAX_XLAT_TABLES			10
-#define MAX_MMAP_REGIONS		18
+#define MAX_XLAT_TABLES			(10 + IMX_DEBUGFS_XLAT_TABLES + \
+					 IMX_RING_CONSOLE_XLAT_TABLES + \
+					 IMX_TELEM_XLAT_TABLES)
+#define MAX_MMAP_REGIONS		(18 + IMX_DEBUGFS_MMAP_REGIONS + \
+					 IMX_RING_CONSOLE_MMAP_REGIONS + \
+					 IMX_TELEM_MMAP_REGIONS)
 #else
-#define MAX_XLAT_TABLES			8
-#define MAX_MMAP_REGIONS		16
+#define MAX_XLAT_TABLES			(8 + IMX_DEBUGFS_XLAT_TABLES + \
+					 IMX_RING_CONSOLE_XLAT_TABLES + \
+					 IMX_TELEM_XLAT_TABLES)
+#define MAX_MMAP_REGIONS		(16 + IMX_DEBUGFS_MMAP_REGIONS + \
+					 IMX_RING_CONSOLE_MMAP_REGIONS + \
+					 IMX_TELEM_MMAP_REGIONS)
 #endif
 
 #define HAB_RVT_BASE			U(0x00000900) /* HAB_RVT for i.MX8MM */
@@ -125,6 +172,7 @@
 #define IMX_DDRPHY_BASE			U(0x3c000000)
 #define IMX_DDR_IPS_BASE		U(0x3d000000)
 #define IMX_DDR_IPS_SIZE		U(0x1900000)
+#define IMX_DDR_PERF_BASE		U(0x3d800000)
 #define IMX_ROM_BASE			U(0x0)
 #define IMX_ROM_SIZE			U(0x40000)
 #define IMX_NS_OCRAM_BASE		U(0x900000)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -522,4 +522,6 @@ void imx_gpc_init(void)
 	 *    Add 100us to make sure the USB OTG SRC is clear safely.
 	 */
 	udelay(100);
+
+	imx_gpc_cpu_pwr_init();
 }
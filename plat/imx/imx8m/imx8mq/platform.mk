@@ -70,10 +70,20 @@ $(eval $(call add_define,IMX8M_DDR4_DVFS))
 endif
 
 USE_COHERENT_MEM	:=	1
+XLAT_TABLES_MERGE_REGIONS :=	1
 RESET_TO_BL31		:=	1
 A53_DISABLE_NON_TEMPORAL_HINT := 0
 WARMBOOT_ENABLE_DCACHE_EARLY	:=	1
 
+# Use the optimised AArch64 string routines from libc_asm
+OVERRIDE_LIBC		:=	1
+ifeq (${OVERRIDE_LIBC},1)
+    include lib/libc/libc_asm.mk
+endif
+
+# Serve the trivial SiP queries from the leaf SMC fast path
+SMC_LEAF_FASTPATH	:=	1
+
 ERRATA_A53_835769	:=	1
 ERRATA_A53_843419	:=	1
 ERRATA_A53_855873	:=	1
@@ -82,6 +92,10 @@ IMX_DRAM_RETENTION	?=	1
 $(eval $(call assert_boolean,IMX_DRAM_RETENTION))
 $(eval $(call add_define,IMX_DRAM_RETENTION))
 
+# The DDR governor is only available on imx8mm and imx8mp
+IMX_DDR_GOVERNOR	:=	0
+$(eval $(call add_define,IMX_DDR_GOVERNOR))
+
 ifeq (${IMX_DRAM_RETENTION},1)
 BL31_SOURCES		+=	${IMX_DRAM_SOURCES}
 endif
@@ -89,5 +89,26 @@ void dram_clock_switch(unsigned int target_drate, bool bypass_mode);
 /* dram frequency change */
 void lpddr4_swffc(struct dram_info *info, unsigned int init_fsp, unsigned int fsp_index);
 void ddr4_swffc(struct dram_info *dram_info, unsigned int pstate);
+void dram_dvfs_switch(unsigned int fsp_index, uint32_t online_cores);
+void dram_dvfs_join(void);
+
+/* dram frequency governor */
+#define IMX_IRQ_SEC_PHY_TIMER	U(29)
+
+#if IMX_DDR_GOVERNOR
+void dram_gov_init(void);
+void dram_gov_sample(void);
+void dram_gov_adopt(void);
+void dram_gov_stop(void);
+void dram_gov_cpu_on(void);
+void dram_gov_cpu_off(void);
+void dram_gov_suspend(void);
+#else
+static inline void dram_gov_init(void) {}
+static inline void dram_gov_stop(void) {}
+static inline void dram_gov_cpu_on(void) {}
+static inline void dram_gov_cpu_off(void) {}
+static inline void dram_gov_suspend(void) {}
+#endif
 
 #endif /* DRAM_H */
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef IMX8M_DEFERRED_AUTH_H
+#define IMX8M_DEFERRED_AUTH_H
+
+#include <stdint.h>
+
+#include <common/tbbr/cot_def.h>
+#include <lib/utils_def.h>
+
+/* BL32_EXTRA1 and BL32_EXTRA2 */
+#define IMX8M_DEFERRED_AUTH_MAX		U(2)
+
+/*
+ * Image which BL2 has loaded but left to BL31 to authenticate, along with the
+ * DER encoded hash it must match, taken from its authenticated certificate.
+ */
+struct imx8m_deferred_auth {
+	unsigned int image_id;
+	uint32_t image_size;
+	uintptr_t image_base;
+	unsigned int hash_len;
+	uint8_t hash[HASH_DER_LEN];
+};
+
+/* List BL2 hands over to BL31 in the second argument */
+struct imx8m_deferred_auth_list {
+	unsigned int count;
+	struct imx8m_deferred_auth images[IMX8M_DEFERRED_AUTH_MAX];
+};
+
+/* BL2 */
+uintptr_t imx8m_deferred_auth_handoff(void);
+
+/* BL31 */
+void imx8m_deferred_auth_setup(uintptr_t handoff);
+void imx8m_deferred_auth_verify(void);
+
+#endif /* IMX8M_DEFERRED_AUTH_H */
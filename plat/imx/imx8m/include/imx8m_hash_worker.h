@@ -0,0 +1,17 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef IMX8M_HASH_WORKER_H
+#define IMX8M_HASH_WORKER_H
+
+void imx8m_hash_worker_entrypoint(void);
+void imx8m_hash_worker_main(void);
+
+int imx8m_hash_worker_start(void);
+void imx8m_hash_worker_stop(void);
+void imx8m_hash_worker_report(unsigned int image_id);
+
+#endif /* IMX8M_HASH_WORKER_H */
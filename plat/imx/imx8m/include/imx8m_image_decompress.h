@@ -0,0 +1,14 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef IMX8M_IMAGE_DECOMPRESS_H
+#define IMX8M_IMAGE_DECOMPRESS_H
+
+void imx8m_image_decompress_init(void);
+void imx8m_image_decompress_prepare(unsigned int image_id);
+int imx8m_image_decompress(unsigned int image_id);
+
+#endif /* IMX8M_IMAGE_DECOMPRESS_H */
@@ -1,4 +1,5 @@
 /*
+ * Copyright 2026 NXP
  * Copyright (c) 2022, Linaro
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -10,6 +11,10 @@
 #include <stdint.h>
 
 #include <arch_helpers.h>
+#include <platform_def.h>
+
+/* The Event Log follows the DTB overlay which points BL33 to it */
+#define IMX8M_NS_EVENT_LOG_BASE	(PLAT_IMX8M_DTO_BASE + PLAT_IMX8M_DTO_MAX_SIZE)
 
 int imx8m_set_nt_fw_info(size_t log_size, uintptr_t *ns_log_addr);
 
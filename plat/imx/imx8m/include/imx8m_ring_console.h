@@ -0,0 +1,17 @@
+/*
+ * Copyright 2026 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef IMX8M_RING_CONSOLE_H
+#define IMX8M_RING_CONSOLE_H
+
+#include <drivers/console.h>
+
+void imx8m_ring_console_init(console_t *uart);
+
+/* BL31 */
+void imx8m_ring_console_runtime(void);
+
+#endif /* IMX8M_RING_CONSOLE_H */
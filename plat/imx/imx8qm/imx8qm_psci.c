@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2018, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -14,6 +14,8 @@
 #include <lib/mmio.h>
 #include <lib/psci/psci.h>
 
+#include <imx_telemetry.h>
+#include <imx_ticks.h>
 #include <plat_imx8.h>
 #include <sci/sci.h>
 
@@ -39,6 +41,9 @@ static const int ap_core_index[PLATFORM_CLUSTER0_CORE_COUNT + PLATFORM_CLUSTER1_
 
 static unsigned int gpt_lpcg, gpt_reg[2];
 
+/* Time spent on SCFW requests when entering system suspend */
+static uint64_t suspend_sc_ticks;
+
 #if (!defined COCKPIT_A53) && (!defined COCKPIT_A72)
 /* save gic dist/redist context when GIC is powered down */
 static struct plat_gic_ctx imx_gicv3_ctx;
@@ -114,6 +119,8 @@ void imx_pwr_domain_on_finish(const psci_power_state_t *target_state)
 
 	plat_gic_pcpu_init();
 	plat_gic_cpuif_enable();
+
+	imx_telem_inc(IMX_TELEM_PSCI_CPU_ON);
 }
 
 void imx_pwr_domain_off(const psci_power_state_t *target_state)
@@ -122,6 +129,8 @@ void imx_pwr_domain_off(const psci_power_state_t *target_state)
 	unsigned int cluster_id = MPIDR_AFFLVL1_VAL(mpidr);
 	unsigned int cpu_id = MPIDR_AFFLVL0_VAL(mpidr);
 
+	imx_telem_inc(IMX_TELEM_PSCI_CPU_OFF);
+
 	plat_gic_cpuif_disable();
 	sc_pm_req_cpu_low_power_mode(ipc_handle,
 		ap_core_index[cpu_id + PLATFORM_CLUSTER0_CORE_COUNT * cluster_id],
@@ -139,6 +148,7 @@ void imx_pwr_domain_off(const psci_power_state_t *target_state)
 
 void imx_domain_suspend(const psci_power_state_t *target_state)
 {
+	uint64_t telem_start = imx_telem_now();
 	u_register_t mpidr = read_mpidr_el1();
 	unsigned int cluster_id = MPIDR_AFFLVL1_VAL(mpidr);
 	unsigned int cpu_id = MPIDR_AFFLVL0_VAL(mpidr);
@@ -172,6 +182,8 @@ void imx_domain_suspend(const psci_power_state_t *target_state)
 		uint32_t irqstr_mu_status, reg;
 		bool irqstr_mu_wakeup = false;
 #endif
+		uint64_t start;
+
 		plat_gic_cpuif_disable();
 
 #if (!defined COCKPIT_A53) && (!defined COCKPIT_A72)
@@ -181,6 +193,16 @@ void imx_domain_suspend(const psci_power_state_t *target_state)
 		imx_enable_irqstr_wakeup();
 
 		cci_disable_snoop_dvm_reqs(MPIDR_AFFLVL1_VAL(mpidr));
+#endif
+
+		/*
+		 * None of the requests below depend on the result of the one
+		 * before, so send them back to back.
+		 */
+		start = read_cntpct_el0();
+		sc_ipc_batch_start();
+
+#if (!defined COCKPIT_A53) && (!defined COCKPIT_A72)
 		/* Put GIC in LP mode. */
 		sc_pm_set_resource_power_mode(ipc_handle, SC_R_GIC, SC_PM_PW_MODE_OFF);
 #endif
@@ -225,6 +247,10 @@ void imx_domain_suspend(const psci_power_state_t *target_state)
 			sc_pm_req_cpu_low_power_mode(ipc_handle,
 				ap_core_index[cpu_id + PLATFORM_CLUSTER0_CORE_COUNT * cluster_id],
 				SC_PM_PW_MODE_OFF, SC_PM_WAKE_SRC_SCU);
+
+		/* The SCFW must be done with the above before IRQSTR is read */
+		(void)sc_ipc_batch_flush(ipc_handle);
+
 		/*
 		 * Check to see if the MU interrupt is pending in the IRQSTR_SCU2
 		 * If interrupt is pending it implies the wakeup interrupt triggered
@@ -254,20 +280,31 @@ void imx_domain_suspend(const psci_power_state_t *target_state)
 			sc_pm_req_cpu_low_power_mode(ipc_handle,
 				ap_core_index[cpu_id + PLATFORM_CLUSTER0_CORE_COUNT * cluster_id],
 				SC_PM_PW_MODE_OFF, SC_PM_WAKE_SRC_GIC);
+
+		(void)sc_ipc_batch_flush(ipc_handle);
 #endif
+		suspend_sc_ticks = read_cntpct_el0() - start;
 	}
+
+	imx_telem_suspend_enter(telem_start);
 }
 
 void imx_domain_suspend_finish(const psci_power_state_t *target_state)
 {
+	uint64_t telem_start = imx_telem_now();
 	u_register_t mpidr = read_mpidr_el1();
 	unsigned int cluster_id = MPIDR_AFFLVL1_VAL(mpidr);
 	unsigned int cpu_id = MPIDR_AFFLVL0_VAL(mpidr);
 
 	/* check the system level status */
 	if (is_local_state_retn(SYSTEM_PWR_STATE(target_state))) {
+		uint64_t start, resume_sc_ticks;
+
 		MU_Resume(SC_IPC_BASE);
 
+		start = read_cntpct_el0();
+		sc_ipc_batch_start();
+
 		sc_pm_req_cpu_low_power_mode(ipc_handle,
 			ap_core_index[cpu_id + PLATFORM_CLUSTER0_CORE_COUNT * cluster_id],
 			SC_PM_PW_MODE_ON, SC_PM_WAKE_SRC_GIC);
@@ -278,10 +315,16 @@ void imx_domain_suspend_finish(const psci_power_state_t *target_state)
 		/* Turn GPT power and restore its clock and registers */
 		sc_pm_set_resource_power_mode(ipc_handle, SC_R_GPT, SC_PM_PW_MODE_ON);
 		sc_pm_clock_enable(ipc_handle, SC_R_GPT, SC_PM_CLK_PER, true, 0);
+		(void)sc_ipc_batch_flush(ipc_handle);
+		resume_sc_ticks = read_cntpct_el0() - start;
+
 		mmio_write_32(IMX_GPT_BASE, gpt_reg[0]);
 		mmio_write_32(IMX_GPT_BASE + 0x4, gpt_reg[1]);
 		mmio_write_32(IMX_GPT_LPCG_BASE, gpt_lpcg);
 
+		start = read_cntpct_el0();
+		sc_ipc_batch_start();
+
 #ifndef COCKPIT_A72
 		sc_pm_req_low_power_mode(ipc_handle, SC_R_A53, SC_PM_PW_MODE_ON);
 		sc_pm_req_sys_if_power_mode(ipc_handle, SC_R_A53, SC_PM_SYS_IF_DDR,
@@ -304,6 +347,16 @@ void imx_domain_suspend_finish(const psci_power_state_t *target_state)
 
 #if (!defined COCKPIT_A53) && (!defined COCKPIT_A72)
 		sc_pm_req_low_power_mode(ipc_handle, SC_R_CCI, SC_PM_PW_MODE_ON);
+#endif
+
+		(void)sc_ipc_batch_flush(ipc_handle);
+		resume_sc_ticks += read_cntpct_el0() - start;
+
+		VERBOSE("SCFW requests took %llu us on suspend, %llu us on resume\n",
+			imx_ticks_to_us(suspend_sc_ticks),
+			imx_ticks_to_us(resume_sc_ticks));
+
+#if (!defined COCKPIT_A53) && (!defined COCKPIT_A72)
 		cci_enable_snoop_dvm_reqs(MPIDR_AFFLVL1_VAL(mpidr));
 
 		/* restore gic context */
@@ -338,6 +391,8 @@ void imx_domain_suspend_finish(const psci_power_state_t *target_state)
 		write_scr_el3(read_scr_el3() & (~SCR_FIQ_BIT));
 		isb();
 	}
+
+	imx_telem_suspend_exit(telem_start);
 }
 
 int imx_validate_ns_entrypoint(uintptr_t ns_entrypoint)
@@ -167,12 +167,34 @@
 #define PLAT_VIRT_ADDR_SPACE_SIZE	(1ull << 36)
 #define PLAT_PHY_ADDR_SPACE_SIZE	(1ull << 36)
 
+#if IMX_TELEMETRY
+/* The telemetry page in DRAM needs a region and its own tables */
+#define IMX_TELEM_MMAP_REGIONS		1
+#define IMX_TELEM_XLAT_TABLES		2
+#else
+#define IMX_TELEM_MMAP_REGIONS		0
+#define IMX_TELEM_XLAT_TABLES		0
+#endif
+
+#if USE_DEBUGFS
+/* The debugfs shared buffer is mapped at run time, with its own tables */
+#define IMX_DEBUGFS_MMAP_REGIONS	1
+#define IMX_DEBUGFS_XLAT_TABLES		2
+#else
+#define IMX_DEBUGFS_MMAP_REGIONS	0
+#define IMX_DEBUGFS_XLAT_TABLES		0
+#endif
+
 #ifdef SPD_trusty
-#define MAX_XLAT_TABLES			10
-#define MAX_MMAP_REGIONS		14
+#define MAX_XLAT_TABLES			(10 + IMX_TELEM_XLAT_TABLES + \
+					 IMX_DEBUGFS_XLAT_TABLES)
+#define MAX_MMAP_REGIONS		(14 + IMX_TELEM_MMAP_REGIONS + \
+					 IMX_DEBUGFS_MMAP_REGIONS)
 #else
-#define MAX_XLAT_TABLES			8
-#define MAX_MMAP_REGIONS		12
+#define MAX_XLAT_TABLES			(8 + IMX_TELEM_XLAT_TABLES + \
+					 IMX_DEBUGFS_XLAT_TABLES)
+#define MAX_MMAP_REGIONS		(12 + IMX_TELEM_MMAP_REGIONS + \
+					 IMX_DEBUGFS_MMAP_REGIONS)
 #endif
 
 #ifdef SPD_trusty
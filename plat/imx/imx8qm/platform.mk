@@ -66,6 +66,33 @@ $(eval $(call add_define,ENABLE_CPU_DYNAMIC_RETENTION))
 ENABLE_L2_DYNAMIC_RETENTION := 1
 $(eval $(call add_define,ENABLE_L2_DYNAMIC_RETENTION))
 
+# Per-core EL3 counters in a DRAM region readable from the normal world
+IMX_TELEMETRY		?=	0
+$(eval $(call assert_boolean,IMX_TELEMETRY))
+$(eval $(call add_define,IMX_TELEMETRY))
+
+ifeq (${IMX_TELEMETRY},1)
+ifdef COCKPIT_A53
+IMX_TELEMETRY_BASE	?=	0xbdfff000
+else
+IMX_TELEMETRY_BASE	?=	0xfdfff000
+endif
+IMX_TELEMETRY_SIZE	?=	0x1000
+$(eval $(call add_define,IMX_TELEMETRY_BASE))
+$(eval $(call add_define,IMX_TELEMETRY_SIZE))
+endif
+
+# Text stats files, e.g. #S/psci, for the debugfs SMC interface
+ifeq (${USE_DEBUGFS},1)
+BL31_CFLAGS		+=	-DPLAT_XLAT_TABLES_DYNAMIC=1
+BL31_SOURCES		+=	plat/imx/common/imx_debugfs.c
+endif
+
+ifneq ($(filter 1,${IMX_TELEMETRY} ${USE_DEBUGFS}),)
+BL31_CFLAGS		+=	-DIMX_TELEM_HOOKS=1
+BL31_SOURCES		+=	plat/imx/common/imx_telemetry.c
+endif
+
 ifeq (${SPD},trusty)
 IMX_SEPARATE_XLAT_TABLE :=	1
 
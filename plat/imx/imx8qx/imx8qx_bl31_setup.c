@@ -17,6 +17,7 @@
 #include <context.h>
 #include <drivers/arm/cci.h>
 #include <drivers/console.h>
+#include <lib/debugfs.h>
 #include <lib/el3_runtime/context_mgmt.h>
 #include <lib/mmio.h>
 #include <lib/xlat_tables/xlat_tables_v2.h>
@@ -29,6 +30,8 @@
 #include <sci/sci.h>
 #include <sec_rsrc.h>
 #include <imx_sip_svc.h>
+#include <imx_telemetry.h>
+#include <imx_ticks.h>
 #include <string.h>
 #ifdef IMX_CAAM_ENABLE
 #include "caam.h"
@@ -46,6 +49,7 @@ IMPORT_SYM(unsigned long, __DATA_END__, BL31_DATA_END);
 
 static entry_point_info_t bl32_image_ep_info;
 static entry_point_info_t bl33_image_ep_info;
+static uint64_t bl31_setup_start;
 
 #if defined(SPD_trusty)
 int mem_region_owned_os_part[64] = {0};
@@ -227,6 +231,8 @@ void imx8_partition_resources(void)
 #endif
 
 	uint32_t cpu_id, cpu_rev = 0x1; /* Set Rev B as default */
+	unsigned int rpc_count = sc_ipc_get_rpc_count();
+	uint64_t ticks = read_cntpct_el0();
 
 	if (imx_get_cpu_rev(&cpu_id, &cpu_rev) != 0)
 		ERROR("Get CPU id and rev failed\n");
@@ -245,19 +251,21 @@ void imx8_partition_resources(void)
 	if (err)
 		ERROR("sc_rm_partition_alloc failed: %u\n", err);
 
-	err = sc_rm_set_parent(ipc_handle, os_part, secure_part);
-	if (err)
-		ERROR("sc_rm_set_parent: %u\n", err);
+	/* none of the requests below return anything but an error code */
+	sc_ipc_batch_start();
+
+	sc_rm_set_parent(ipc_handle, os_part, secure_part);
 
-	/* set secure resources to NOT-movable */
+	/* set secure resources to NOT-movable, a range at a time */
 	for (i = 0; i < (ARRAY_SIZE(secure_rsrcs)); i++) {
-		err = sc_rm_set_resource_movable(ipc_handle,
-			 secure_rsrcs[i], secure_rsrcs[i], false);
-		if (err)
-			ERROR("sc_rm_set_resource_movable: rsrc %u, ret %u\n",
-				secure_rsrcs[i], err);
+		sc_rm_set_resource_movable(ipc_handle,
+			 secure_rsrcs[i].fst, secure_rsrcs[i].lst, false);
 	}
 
+	err = sc_ipc_batch_flush(ipc_handle);
+	if (err)
+		ERROR("Setting secure resources NOT-movable failed: %u\n", err);
+
 	/*
 	 * sc_rm_set_peripheral_permissions
 	 * sc_rm_set_memreg_permissions
@@ -517,31 +525,26 @@ void imx8_partition_resources(void)
 				SC_R_M4_0_PID0, err);
 	}
 
+	sc_ipc_batch_start();
+
 	/* move all movable resources and pins to non-secure partition */
-	err = sc_rm_move_all(ipc_handle, secure_part, os_part, true, true);
-	if (err)
-		ERROR("sc_rm_move_all: %u\n", err);
+	sc_rm_move_all(ipc_handle, secure_part, os_part, true, true);
 	if (owned) {
-		err = sc_rm_set_resource_movable(ipc_handle, SC_R_M4_0_PID0,
+		sc_rm_set_resource_movable(ipc_handle, SC_R_M4_0_PID0,
 				SC_R_M4_0_PID0, true);
-		if (err)
-			ERROR("sc_rm_set_resource_movable: rsrc %u, ret %u\n",
-				SC_R_M4_0_PID0, err);
-		err = sc_rm_assign_resource(ipc_handle, os_part, SC_R_M4_0_PID0);
-		if (err)
-			ERROR("sc_rm_assign_resource: rsrc %u, ret %u\n",
-				SC_R_M4_0_PID0, err);
+		sc_rm_assign_resource(ipc_handle, os_part, SC_R_M4_0_PID0);
 	}
 
 	/* iterate through peripherals to give NS OS part access */
 	for (i = 0; i < ARRAY_SIZE(ns_access_allowed); i++) {
-		err = sc_rm_set_peripheral_permissions(ipc_handle,
+		sc_rm_set_peripheral_permissions(ipc_handle,
 			ns_access_allowed[i], os_part, SC_RM_PERM_FULL);
-		if (err)
-			ERROR("sc_rm_set_peripheral_permissions: rsrc %u, \
-				ret %u\n", ns_access_allowed[i], err);
 	}
 
+	err = sc_ipc_batch_flush(ipc_handle);
+	if (err)
+		ERROR("Moving resources to NS OS part failed: %u\n", err);
+
 #if defined(SPD_trusty)
 	/* configure normal memory to dpu part */
 	for (i = 0; i < index; i++) {
@@ -561,6 +564,10 @@ void imx8_partition_resources(void)
 		NOTICE("Partitioning Failed\n");
 	else
 		NOTICE("Non-secure Partitioning Succeeded\n");
+
+	INFO("Partitioning took %u SCFW requests, %llu us\n",
+	     sc_ipc_get_rpc_count() - rpc_count,
+	     imx_ticks_to_us(read_cntpct_el0() - ticks));
 }
 
 #if defined(SPD_trusty)
@@ -603,6 +610,8 @@ void bl31_early_platform_setup2(u_register_t arg0, u_register_t arg1,
 		memcpy(ptr, data, count);
 	}
 
+	bl31_setup_start = read_cntpct_el0();
+
 #if DEBUG_CONSOLE
 	static console_t console;
 #endif
@@ -626,12 +635,15 @@ void bl31_early_platform_setup2(u_register_t arg0, u_register_t arg1,
 	console_lpuart_register(IMX_BOOT_UART_BASE, IMX_BOOT_UART_CLK_IN_HZ,
 		     IMX_CONSOLE_BAUDRATE, &console);
 #endif
+	sc_ipc_batch_start();
+
 	/* Turn on MU1 for non-secure OS/Hypervisor */
 	sc_pm_set_resource_power_mode(ipc_handle, SC_R_MU_1A, SC_PM_PW_MODE_ON);
 
 	/* Turn on GPT_0's power & clock for non-secure OS/Hypervisor */
 	sc_pm_set_resource_power_mode(ipc_handle, SC_R_GPT_0, SC_PM_PW_MODE_ON);
 	sc_pm_clock_enable(ipc_handle, SC_R_GPT_0, SC_PM_CLK_PER, true, 0);
+	(void)sc_ipc_batch_flush(ipc_handle);
 	mmio_write_32(IMX_GPT0_LPCG_BASE, mmio_read_32(IMX_GPT0_LPCG_BASE) | (1 << 25));
 
 	/*
@@ -641,6 +653,7 @@ void bl31_early_platform_setup2(u_register_t arg0, u_register_t arg1,
 	imx8_partition_resources();
 
 #ifdef IMX_CAAM_ENABLE
+	sc_ipc_batch_start();
 	sc_pm_set_resource_power_mode(ipc_handle, SC_R_CAAM_JR3, SC_PM_PW_MODE_ON);
 	sc_pm_set_resource_power_mode(ipc_handle, SC_R_CAAM_JR3_OUT, SC_PM_PW_MODE_ON);
 #ifdef SPD_trusty
@@ -648,6 +661,7 @@ void bl31_early_platform_setup2(u_register_t arg0, u_register_t arg1,
 	sc_pm_set_resource_power_mode(ipc_handle, SC_R_CAAM_JR2_OUT, SC_PM_PW_MODE_ON);
 	sc_pm_set_resource_power_mode(ipc_handle, SC_R_MU_4A, SC_PM_PW_MODE_ON);
 #endif
+	(void)sc_ipc_batch_flush(ipc_handle);
 #endif
 
 	bl33_image_ep_info.pc = PLAT_NS_IMAGE_OFFSET;
@@ -696,6 +710,11 @@ void bl31_plat_arch_setup(void)
 		MT_RW | MT_MEMORY | MT_SECURE);
 	mmap_add(imx_mmap);
 
+#if IMX_TELEMETRY
+	mmap_add_region(IMX_TELEMETRY_BASE, IMX_TELEMETRY_BASE, IMX_TELEMETRY_SIZE,
+			MT_MEMORY | MT_RW | MT_NS);
+#endif
+
 #if defined(SPD_opteed) || defined(SPD_trusty)
 	mmap_add_region(BL32_BASE, BL32_BASE, BL32_SIZE, MT_MEMORY | MT_RW);
 #endif
@@ -717,6 +736,15 @@ void bl31_platform_setup(void)
 {
 	plat_gic_driver_init();
 	plat_gic_init();
+
+	imx_telem_init();
+#if USE_DEBUGFS
+	debugfs_init();
+#endif
+
+	INFO("BL31 setup took %u SCFW requests, %llu us\n",
+	     sc_ipc_get_rpc_count(),
+	     imx_ticks_to_us(read_cntpct_el0() - bl31_setup_start));
 }
 
 entry_point_info_t *bl31_plat_get_next_image_ep_info(unsigned int type)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2018, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -13,6 +13,8 @@
 #include <lib/mmio.h>
 #include <lib/psci/psci.h>
 
+#include <imx_telemetry.h>
+#include <imx_ticks.h>
 #include <plat_imx8.h>
 #include <sci/sci.h>
 
@@ -28,6 +30,9 @@ static const int ap_core_index[PLATFORM_CORE_COUNT] = {
 static struct plat_gic_ctx imx_gicv3_ctx;
 static unsigned int gpt_lpcg, gpt_reg[2];
 
+/* Time spent on SCFW requests when entering system suspend */
+static uint64_t suspend_sc_ticks;
+
 static void imx_enable_irqstr_wakeup(void)
 {
 	uint32_t irq_mask;
@@ -86,6 +91,8 @@ void imx_pwr_domain_on_finish(const psci_power_state_t *target_state)
 {
 	plat_gic_pcpu_init();
 	plat_gic_cpuif_enable();
+
+	imx_telem_inc(IMX_TELEM_PSCI_CPU_ON);
 }
 
 int imx_validate_ns_entrypoint(uintptr_t ns_entrypoint)
@@ -98,6 +105,8 @@ void imx_pwr_domain_off(const psci_power_state_t *target_state)
 	u_register_t mpidr = read_mpidr_el1();
 	unsigned int cpu_id = MPIDR_AFFLVL0_VAL(mpidr);
 
+	imx_telem_inc(IMX_TELEM_PSCI_CPU_OFF);
+
 	plat_gic_cpuif_disable();
 	sc_pm_req_cpu_low_power_mode(ipc_handle, ap_core_index[cpu_id],
 		SC_PM_PW_MODE_OFF, SC_PM_WAKE_SRC_NONE);
@@ -106,6 +115,7 @@ void imx_pwr_domain_off(const psci_power_state_t *target_state)
 
 void imx_domain_suspend(const psci_power_state_t *target_state)
 {
+	uint64_t telem_start = imx_telem_now();
 	u_register_t mpidr = read_mpidr_el1();
 	unsigned int cpu_id = MPIDR_AFFLVL0_VAL(mpidr);
 
@@ -128,6 +138,7 @@ void imx_domain_suspend(const psci_power_state_t *target_state)
 		uint32_t irqstr_mu_mask = (1 << (IRQSTR_PLAT_OS_MU_IRQ % 32));
 		uint32_t irqstr_mu_status, reg;
 		bool irqstr_mu_wakeup = false;
+		uint64_t start;
 
 		plat_gic_cpuif_disable();
 
@@ -136,6 +147,13 @@ void imx_domain_suspend(const psci_power_state_t *target_state)
 		/* enable the irqsteer for wakeup */
 		imx_enable_irqstr_wakeup();
 
+		/*
+		 * None of the requests below depend on the result of the one
+		 * before, so send them back to back.
+		 */
+		start = read_cntpct_el0();
+		sc_ipc_batch_start();
+
 		/* Save GPT clock and registers, then turn off its power */
 		gpt_lpcg = mmio_read_32(IMX_GPT0_LPCG_BASE);
 		gpt_reg[0] = mmio_read_32(IMX_GPT0_BASE);
@@ -157,6 +175,10 @@ void imx_domain_suspend(const psci_power_state_t *target_state)
 		if (!imx_is_wakeup_src_irqsteer())
 			sc_pm_req_cpu_low_power_mode(ipc_handle, ap_core_index[cpu_id],
 				SC_PM_PW_MODE_OFF, SC_PM_WAKE_SRC_SCU);
+
+		/* The SCFW must be done with the above before IRQSTR is read */
+		(void)sc_ipc_batch_flush(ipc_handle);
+
 		/*
 		 * Check to see if the MU interrupt is pending in the IRQSTR_SCU2
 		 * If interrupt is pending it implies the wakeup interrupt triggered
@@ -179,17 +201,27 @@ void imx_domain_suspend(const psci_power_state_t *target_state)
 				SC_PM_PW_MODE_OFF, SC_PM_WAKE_SRC_IRQSTEER);
 		} else
 			sc_pm_set_resource_power_mode(ipc_handle, SC_R_IRQSTR_SCU2, SC_PM_PW_MODE_OFF);
+
+		suspend_sc_ticks = read_cntpct_el0() - start;
 	}
+
+	imx_telem_suspend_enter(telem_start);
 }
 
 void imx_domain_suspend_finish(const psci_power_state_t *target_state)
 {
+	uint64_t telem_start = imx_telem_now();
 	u_register_t mpidr = read_mpidr_el1();
 	unsigned int cpu_id = MPIDR_AFFLVL0_VAL(mpidr);
 
 	if (is_local_state_retn(target_state->pwr_domain_state[PLAT_MAX_PWR_LVL])) {
+		uint64_t start, resume_sc_ticks;
+
 		MU_Resume(SC_IPC_BASE);
 
+		start = read_cntpct_el0();
+		sc_ipc_batch_start();
+
 		sc_pm_req_low_power_mode(ipc_handle, ap_core_index[cpu_id], SC_PM_PW_MODE_ON);
 		sc_pm_req_cpu_low_power_mode(ipc_handle, ap_core_index[cpu_id],
 			SC_PM_PW_MODE_ON, SC_PM_WAKE_SRC_GIC);
@@ -197,16 +229,23 @@ void imx_domain_suspend_finish(const psci_power_state_t *target_state)
 		/* Put GIC back to high power mode. */
 		sc_pm_set_resource_power_mode(ipc_handle, SC_R_GIC, SC_PM_PW_MODE_ON);
 
+		/* Turn on GPT power and clock */
+		sc_pm_set_resource_power_mode(ipc_handle, SC_R_GPT_0, SC_PM_PW_MODE_ON);
+		sc_pm_clock_enable(ipc_handle, SC_R_GPT_0, SC_PM_CLK_PER, true, 0);
+		(void)sc_ipc_batch_flush(ipc_handle);
+		resume_sc_ticks = read_cntpct_el0() - start;
+
 		/* restore gic context */
 		plat_gic_restore(cpu_id, &imx_gicv3_ctx);
 
-		/* Turn on GPT power and restore its clock and registers */
-		sc_pm_set_resource_power_mode(ipc_handle, SC_R_GPT_0, SC_PM_PW_MODE_ON);
-		sc_pm_clock_enable(ipc_handle, SC_R_GPT_0, SC_PM_CLK_PER, true, 0);
+		/* Restore GPT clock and registers */
 		mmio_write_32(IMX_GPT0_BASE, gpt_reg[0]);
 		mmio_write_32(IMX_GPT0_BASE + 0x4, gpt_reg[1]);
 		mmio_write_32(IMX_GPT0_LPCG_BASE, gpt_lpcg);
 
+		start = read_cntpct_el0();
+		sc_ipc_batch_start();
+
 		sc_pm_req_low_power_mode(ipc_handle, SC_R_A35, SC_PM_PW_MODE_ON);
 		sc_pm_req_sys_if_power_mode(ipc_handle, SC_R_A35, SC_PM_SYS_IF_DDR,
 			SC_PM_PW_MODE_ON, SC_PM_PW_MODE_ON);
@@ -215,6 +254,13 @@ void imx_domain_suspend_finish(const psci_power_state_t *target_state)
 		sc_pm_req_sys_if_power_mode(ipc_handle, SC_R_A35, SC_PM_SYS_IF_INTERCONNECT,
 			SC_PM_PW_MODE_ON, SC_PM_PW_MODE_ON);
 
+		(void)sc_ipc_batch_flush(ipc_handle);
+		resume_sc_ticks += read_cntpct_el0() - start;
+
+		VERBOSE("SCFW requests took %llu us on suspend, %llu us on resume\n",
+			imx_ticks_to_us(suspend_sc_ticks),
+			imx_ticks_to_us(resume_sc_ticks));
+
 		/* disable the irqsteer wakeup */
 		imx_disable_irqstr_wakeup();
 
@@ -232,6 +278,8 @@ void imx_domain_suspend_finish(const psci_power_state_t *target_state)
 		write_scr_el3(read_scr_el3() & (~SCR_FIQ_BIT));
 		isb();
 	}
+
+	imx_telem_suspend_exit(telem_start);
 }
 
 static const plat_psci_ops_t imx_plat_psci_ops = {
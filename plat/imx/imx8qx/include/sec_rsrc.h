@@ -1,28 +1,31 @@
 /*
- * Copyright (c) 2015-2018, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+/* resources fst to lst, which the SCFW can set up with a single request */
+struct sec_rsrc_range {
+	sc_rsrc_t fst;
+	sc_rsrc_t lst;
+};
+
 /* resources that are going to stay in secure partition */
-sc_rsrc_t secure_rsrcs[] = {
-	SC_R_MU_0A,
-	SC_R_A35,
-	SC_R_A35_0,
-	SC_R_A35_1,
-	SC_R_A35_2,
-	SC_R_A35_3,
-	SC_R_GIC,
-	SC_R_SYSTEM,
-	SC_R_IRQSTR_SCU2,
-	SC_R_GPT_0,
+const struct sec_rsrc_range secure_rsrcs[] = {
+	{ SC_R_MU_0A, SC_R_MU_0A },
+	{ SC_R_A35, SC_R_A35_3 },
+	{ SC_R_GIC, SC_R_GIC },
+	{ SC_R_SYSTEM, SC_R_SYSTEM },
+	{ SC_R_IRQSTR_SCU2, SC_R_IRQSTR_SCU2 },
+	{ SC_R_GPT_0, SC_R_GPT_0 },
 #ifdef IMX_CAAM_ENABLE
-	SC_R_CAAM_JR3,
-	SC_R_CAAM_JR3_OUT,
 #ifdef SPD_trusty
-	SC_R_CAAM_JR2,
-	SC_R_CAAM_JR2_OUT,
-	SC_R_MU_4A
+	{ SC_R_CAAM_JR2, SC_R_CAAM_JR3 },
+	{ SC_R_CAAM_JR2_OUT, SC_R_CAAM_JR3_OUT },
+	{ SC_R_MU_4A, SC_R_MU_4A }
+#else
+	{ SC_R_CAAM_JR3, SC_R_CAAM_JR3 },
+	{ SC_R_CAAM_JR3_OUT, SC_R_CAAM_JR3_OUT }
 #endif
 #endif
 };
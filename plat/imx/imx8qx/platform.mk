@@ -68,6 +68,33 @@ $(eval $(call add_define,BL32_BASE))
 BL32_SIZE		?=	0x2000000
 $(eval $(call add_define,BL32_SIZE))
 
+# Per-core EL3 counters in a DRAM region readable from the normal world
+IMX_TELEMETRY		?=	0
+$(eval $(call assert_boolean,IMX_TELEMETRY))
+$(eval $(call add_define,IMX_TELEMETRY))
+
+ifeq (${IMX_TELEMETRY},1)
+ifeq (${PLAT},imx8dx)
+IMX_TELEMETRY_BASE	?=	0x95fff000
+else
+IMX_TELEMETRY_BASE	?=	0xfdfff000
+endif
+IMX_TELEMETRY_SIZE	?=	0x1000
+$(eval $(call add_define,IMX_TELEMETRY_BASE))
+$(eval $(call add_define,IMX_TELEMETRY_SIZE))
+endif
+
+# Text stats files, e.g. #S/psci, for the debugfs SMC interface
+ifeq (${USE_DEBUGFS},1)
+BL31_CFLAGS		+=	-DPLAT_XLAT_TABLES_DYNAMIC=1
+BL31_SOURCES		+=	plat/imx/common/imx_debugfs.c
+endif
+
+ifneq ($(filter 1,${IMX_TELEMETRY} ${USE_DEBUGFS}),)
+BL31_CFLAGS		+=	-DIMX_TELEM_HOOKS=1
+BL31_SOURCES		+=	plat/imx/common/imx_telemetry.c
+endif
+
 ifeq (${SPD},trusty)
 IMX_SEPARATE_XLAT_TABLE :=	1
 
@@ -70,6 +70,7 @@ void dram_info_init(unsigned long dram_timing_base);
 
 /* dram frequency change */
 int ddr_swffc(struct dram_timing_info *dram_info, unsigned int pstate);
+void ddr_pll_cache_init(struct dram_timing_info *info, unsigned int num_fsp);
 void ddr_hwffc(uint32_t pstate);
 
 /* dram retention */
@@ -15,6 +15,16 @@
 #define RDIV_MASK		GENMASK_32(15, 13)
 #define ODIV_MASK		GENMASK_32(7, 0)
 
+/*
+ * Fvco = (Fref / rdiv) * (mfi + mfn / mfd), Fout = Fvco / odiv, with
+ * Fref / rdiv in 20MHz ~ 40MHz and Fvco in 2.5GHz ~ 5GHz
+ */
+#define FRACPLL_REF_RATE	U(24000000)
+#define FRACPLL_VCO_MIN		ULL(2500000000)
+#define FRACPLL_VCO_MAX		ULL(5000000000)
+#define FRACPLL_ODIV_MIN	2U
+#define FRACPLL_ODIV_MAX	255U
+
 /* GPR2 used for DDR alt clock source select 0: PLL, 1: CCM ALT */
 #define CCM_GPR2		U(0x44454840)
 #define DRAM_ALT_CLK		U(0x44452600)
@@ -56,26 +66,123 @@ static struct imx_fracpll_rate_table imx9_fracpll_tbl[] = {
 	FRAC_PLL_RATE(166000000U, 1, 166, 24, 0, 1), /* 166Mhz */
 };
 
-int ddr_pll_init(unsigned int drate)
+/* settings computed for the rates not in imx9_fracpll_tbl, one per setpoint */
+static struct imx_fracpll_rate_table fracpll_cache[4];
+
+static uint32_t fracpll_gcd(uint32_t a, uint32_t b)
 {
-	uint32_t pll_div, pll_mfn, pll_mfd, new_div, new_mfn, new_mfd;
-	struct imx_fracpll_rate_table *rate;
-	unsigned int freq = (drate / 4) * 1000000;
-	unsigned int maxtimeout = 10;
+	uint32_t t;
+
+	while (b != 0U) {
+		t = a % b;
+		a = b;
+		b = t;
+	}
+
+	return a;
+}
+
+/*
+ * Compute the PLL settings for 'freq', in Hz. The reference clock is used
+ * undivided. The fraction is exact as 'freq' is a whole number of Hz; the
+ * output divider giving the smallest denominator, then the highest VCO
+ * frequency, is picked.
+ */
+static int fracpll_solve(uint32_t freq, struct imx_fracpll_rate_table *rate)
+{
+	uint64_t vco, rem;
+	uint32_t odiv, gcd;
+	bool found = false;
+
+	for (odiv = FRACPLL_ODIV_MAX; odiv >= FRACPLL_ODIV_MIN; odiv--) {
+		vco = (uint64_t)freq * odiv;
+		if ((vco < FRACPLL_VCO_MIN) || (vco > FRACPLL_VCO_MAX)) {
+			continue;
+		}
+
+		rem = vco % FRACPLL_REF_RATE;
+		gcd = (rem == 0U) ? FRACPLL_REF_RATE :
+				    fracpll_gcd(rem, FRACPLL_REF_RATE);
+
+		if (!found || ((FRACPLL_REF_RATE / gcd) < (uint32_t)rate->mfd)) {
+			rate->rate = freq;
+			rate->rdiv = 1;
+			rate->mfi = vco / FRACPLL_REF_RATE;
+			rate->odiv = odiv;
+			rate->mfn = rem / gcd;
+			rate->mfd = FRACPLL_REF_RATE / gcd;
+			found = true;
+		}
+
+		if (rate->mfd == 1) {
+			break;
+		}
+	}
+
+	return found ? 0 : -1;
+}
+
+static const struct imx_fracpll_rate_table *fracpll_get_rate(uint32_t freq)
+{
+	struct imx_fracpll_rate_table *slot = NULL;
 	unsigned int i;
 
 	for (i = 0; i < ARRAY_SIZE(imx9_fracpll_tbl); i++) {
 		if (freq == imx9_fracpll_tbl[i].rate)
-			break;
+			return &imx9_fracpll_tbl[i];
+	}
+
+	for (i = 0; i < ARRAY_SIZE(fracpll_cache); i++) {
+		if (freq == fracpll_cache[i].rate)
+			return &fracpll_cache[i];
+		if (slot == NULL && fracpll_cache[i].rate == 0U)
+			slot = &fracpll_cache[i];
 	}
 
-	if (i == ARRAY_SIZE(imx9_fracpll_tbl)) {
+	/* more rates than setpoints, solve again each time */
+	if (slot == NULL) {
+		slot = &fracpll_cache[ARRAY_SIZE(fracpll_cache) - 1];
+	}
+
+	if (fracpll_solve(freq, slot) != 0) {
+		slot->rate = 0U;
+		return NULL;
+	}
+
+	VERBOSE("DDR PLL %u Hz: rdiv %d mfi %d mfn %d mfd %d odiv %d\n",
+		freq, slot->rdiv, slot->mfi, slot->mfn, slot->mfd, slot->odiv);
+
+	return slot;
+}
+
+/* Compute the PLL settings of all the setpoints ahead of any switch */
+void ddr_pll_cache_init(struct dram_timing_info *info, unsigned int num_fsp)
+{
+	unsigned int i;
+
+	for (i = 0; i < num_fsp; i++) {
+		if (info->fsp_cfg != NULL && info->fsp_cfg[i].bypass)
+			continue;
+
+		if (fracpll_get_rate((info->fsp_table[i] / 4) * 1000000) == NULL)
+			WARN("no valid PLL setting for %u MTS\n",
+			     info->fsp_table[i]);
+	}
+}
+
+int ddr_pll_init(unsigned int drate)
+{
+	uint32_t pll_div, pll_mfn, pll_mfd, new_div, new_mfn, new_mfd;
+	const struct imx_fracpll_rate_table *rate;
+	unsigned int freq = (drate / 4) * 1000000;
+	unsigned int maxtimeout = 10;
+
+	rate = fracpll_get_rate(freq);
+	if (rate == NULL) {
 		WARN("no valid freq table: %u\n", freq);
 		return -1;
 	}
 
-	rate = &imx9_fracpll_tbl[i];
-
 	new_div = ((rate->mfi << 16) & MFI_MASK) | ((rate->rdiv << 13) & RDIV_MASK) |
 		  (rate->odiv & ODIV_MASK);
 	new_mfn = rate->mfn << 2;
@@ -12,9 +12,16 @@
 #include <drivers/delay_timer.h>
 
 #include <dram.h>
+#include <imx_sip_svc.h>
+#include <imx_telemetry.h>
+#include <imx_ticks.h>
 
 #define IMX_SIP_DDR_DVFS_GET_FREQ_COUNT		0x10
 #define IMX_SIP_DDR_DVFS_GET_FREQ_INFO		0x11
+#define IMX_SIP_DDR_DVFS_GET_SWITCH_STATS	0x13
+
+#define DVFS_PATH_HWFFC		0U
+#define DVFS_PATH_SWFFC		1U
 
 /* lock used for DDR DVFS */
 spinlock_t dfs_lock;
@@ -25,6 +32,16 @@ static unsigned int cur_fsp;
 static volatile bool in_progress = false;
 static bool in_swffc = false;
 
+/* Frequency switches done by each path, times in counter ticks */
+static struct {
+	uint32_t count;
+	/* the other cores could not access the DDR */
+	uint64_t stall_ticks;
+	uint64_t stall_max_ticks;
+	/* the core asking for the switch was busy with it */
+	uint64_t switch_ticks;
+} dvfs_stats[2];
+
 unsigned long ddrphy_addr_remap(uint32_t paddr_apb_from_ctlr)
 {
 	uint32_t paddr_apb_qual;
@@ -309,6 +326,7 @@ int ddrc_apply_reg_config(enum reg_type type, struct dram_cfg_param *reg_config)
 static uint64_t waiting_dvfs(uint32_t id, uint32_t flags,
 		void *handle, void *cookie)
 {
+	uint64_t start = imx_telem_now();
 	uint32_t irq;
 
 	irq = plat_ic_acknowledge_interrupt();
@@ -316,7 +334,7 @@ static uint64_t waiting_dvfs(uint32_t id, uint32_t flags,
 		plat_ic_end_of_interrupt(irq);
 
 	/* set the WFE done status */
-	spin_lock(&dfs_lock);
+	imx_telem_spin_lock(&dfs_lock);
 	core_count++;
 	dsb();
 	spin_unlock(&dfs_lock);
@@ -328,6 +346,8 @@ static uint64_t waiting_dvfs(uint32_t id, uint32_t flags,
 		wfe();
 	}
 
+	imx_telem_add_time(IMX_TELEM_DVFS_WAIT_TICKS, start);
+
 	return 0;
 }
 
@@ -355,6 +375,9 @@ void dram_info_init(unsigned long dram_timing_base)
 	/* set SR_FAST_WK_EN to 1 by default */
 	mmio_setbits_32(REG_DDR_SDRAM_CFG_3, BIT(1));
 
+	/* work out the PLL settings of each setpoint once */
+	ddr_pll_cache_init(timing_info, num_fsp);
+
 	/* Register the EL3 handler for DDR DVFS */
 	set_interrupt_rm_flag(flags, NON_SECURE);
 	rc = register_interrupt_type_handler(INTR_TYPE_EL3, waiting_dvfs, flags);
@@ -362,6 +385,48 @@ void dram_info_init(unsigned long dram_timing_base)
 		panic();
 }
 
+static void dram_dvfs_account(unsigned int path, unsigned int from,
+			      uint64_t stall, uint64_t start)
+{
+	dvfs_stats[path].count++;
+	dvfs_stats[path].stall_ticks += stall;
+	if (stall > dvfs_stats[path].stall_max_ticks)
+		dvfs_stats[path].stall_max_ticks = stall;
+	dvfs_stats[path].switch_ticks += read_cntpct_el0() - start;
+
+	imx_telem_dvfs_switch(timing_info->fsp_table[from],
+			      timing_info->fsp_table[cur_fsp], start);
+}
+
+/*
+ * Setpoint 1 is the half speed of setpoint 0 and is only switched to and from
+ * by HWFFC, so go through setpoint 0 when SWFFC is needed on the way.
+ */
+static int dram_swffc(unsigned int fsp_index)
+{
+	unsigned int target = (fsp_index == 1U) ? 0U : fsp_index;
+	int ret;
+
+	if (cur_fsp == 1U) {
+		ddr_hwffc(0U);
+		cur_fsp = 0U;
+	}
+
+	ret = ddr_swffc(timing_info, target);
+	if (ret != 0)
+		return ret;
+
+	cur_fsp = target;
+	in_swffc = (target != 0U);
+
+	if (fsp_index == 1U) {
+		ddr_hwffc(1U);
+		cur_fsp = 1U;
+	}
+
+	return 0;
+}
+
 int dram_dvfs_handler(uint32_t smc_fid, void *handle,
 		u_register_t x1, u_register_t x2, u_register_t x3)
 {
@@ -369,6 +434,9 @@ int dram_dvfs_handler(uint32_t smc_fid, void *handle,
 	uint32_t online_cpus = x2 - 1; 
 	uint64_t mpidr = read_mpidr_el1();
 	unsigned int cpu_id = MPIDR_AFFLVL1_VAL(mpidr);
+	unsigned int from = cur_fsp;
+	uint64_t start, stall;
+	unsigned int path;
 	int ret = 0;
 
 	/* get the fsp num, return the number of supported fsp */
@@ -376,13 +444,36 @@ int dram_dvfs_handler(uint32_t smc_fid, void *handle,
 		SMC_RET1(handle, num_fsp);
 	} else if (IMX_SIP_DDR_DVFS_GET_FREQ_INFO == x1) {
 		SMC_RET1(handle, timing_info->fsp_table[x2]);
-	} else if (fsp_index > num_fsp) {
+	} else if (IMX_SIP_DDR_DVFS_GET_SWITCH_STATS == x1) {
+		/* x2 selects the path, 0 for HWFFC, 1 for SWFFC */
+		if (x2 > DVFS_PATH_SWFFC)
+			SMC_RET1(handle, SMC_UNK);
+		SMC_RET4(handle, dvfs_stats[x2].count,
+			 imx_ticks_to_us(dvfs_stats[x2].stall_ticks),
+			 imx_ticks_to_us(dvfs_stats[x2].stall_max_ticks),
+			 imx_ticks_to_us(dvfs_stats[x2].switch_ticks));
+	} else if (fsp_index >= num_fsp) {
 		/* fsp out of range */
 		SMC_RET1(handle, SMC_UNK);
 	} else if (fsp_index == cur_fsp) {
 		SMC_RET1(handle, SMC_OK);
 	}
 
+	start = read_cntpct_el0();
+	path = (!in_swffc && fsp_index <= 1U) ? DVFS_PATH_HWFFC : DVFS_PATH_SWFFC;
+
+	/*
+	 * HWFFC is done by the DDRC on its own, which holds the accesses of
+	 * the other cores until the DDR is out of self refresh again. BL31
+	 * runs from OCRAM, so they can carry on meanwhile.
+	 */
+	if (IMX_DDR_HWFFC_NO_PARK && path == DVFS_PATH_HWFFC) {
+		ddr_hwffc(fsp_index);
+		cur_fsp = fsp_index;
+		dram_dvfs_account(path, from, read_cntpct_el0() - start, start);
+		SMC_RET1(handle, SMC_OK);
+	}
+
 	in_progress = true;
 	dsb();
 
@@ -402,17 +493,12 @@ int dram_dvfs_handler(uint32_t smc_fid, void *handle,
 	dcsw_op_all(DCCSW);
 
 	/* if current pstate 0, next state to 1: hwffc */
-	if (!in_swffc && (fsp_index == 1 || fsp_index == 0)) {
+	if (path == DVFS_PATH_HWFFC) {
 		ddr_hwffc(fsp_index);
-		in_swffc = false;
-	} else if(fsp_index != 1) {
-		ret = ddr_swffc(timing_info, fsp_index);
-		if(ret == 0)
-			in_swffc = (fsp_index == 2);
-	}
-
-	if(ret == 0)
 		cur_fsp = fsp_index;
+	} else {
+		ret = dram_swffc(fsp_index);
+	}
 
 	in_progress = false;
 	core_count = 0;
@@ -420,5 +506,23 @@ int dram_dvfs_handler(uint32_t smc_fid, void *handle,
 	sev();
 	isb();
 
+	stall = read_cntpct_el0() - start;
+	if (ret == 0)
+		dram_dvfs_account(path, from, stall, start);
+
 	SMC_RET1(handle, ret);
 }
+
+#if SMC_LEAF_FASTPATH
+static u_register_t dram_dvfs_get_freq_count(u_register_t x1, u_register_t x2,
+					     u_register_t x3, u_register_t x4)
+{
+	imx_telem_sip_call(IMX_SIP_DDR_DVFS);
+
+	return num_fsp;
+}
+
+DECLARE_RT_SVC_LEAF(imx_sip_ddr_dvfs_freq_count, IMX_SIP_DDR_DVFS,
+		    RT_SVC_LEAF_MATCH_X1, IMX_SIP_DDR_DVFS_GET_FREQ_COUNT,
+		    dram_dvfs_get_freq_count);
+#endif
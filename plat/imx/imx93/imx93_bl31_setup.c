@@ -14,6 +14,7 @@
 #include <drivers/console.h>
 #include <drivers/generic_delay_timer.h>
 #include <drivers/nxp/trdc/imx_trdc.h>
+#include <lib/debugfs.h>
 #include <lib/el3_runtime/context_mgmt.h>
 #include <lib/mmio.h>
 #include <lib/xlat_tables/xlat_tables_v2.h>
@@ -22,6 +23,7 @@
 #include <ele_api.h>
 #include <dram.h>
 #include <imx8_lpuart.h>
+#include <imx_telemetry.h>
 #include <plat_common.h>
 #include <plat_imx8.h>
 #include <platform_def.h>
@@ -118,6 +120,10 @@ void bl31_plat_arch_setup(void)
 #ifdef SPD_trusty
 		/* Map Tee memory */
 		MAP_BL32_TOTAL,
+#endif
+#if IMX_TELEMETRY
+		MAP_REGION_FLAT(IMX_TELEMETRY_BASE, IMX_TELEMETRY_SIZE,
+				MT_MEMORY | MT_RW | MT_NS),
 #endif
 		{0}
 	};
@@ -154,6 +160,11 @@ void bl31_platform_setup(void)
 {
 	generic_delay_timer_init();
 
+	imx_telem_init();
+#if USE_DEBUGFS
+	debugfs_init();
+#endif
+
 	/* get soc info */
 	ele_get_soc_info();
 
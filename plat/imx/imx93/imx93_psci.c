@@ -17,6 +17,7 @@
 #include <drivers/arm/gicv3.h>
 #include "../drivers/arm/gic/v3/gicv3_private.h"
 
+#include <imx_telemetry.h>
 #include <plat_imx8.h>
 #include <pwr_ctrl.h>
 #include <sema42.h>
@@ -696,6 +697,8 @@ void imx_pwr_domain_on_finish(const psci_power_state_t *target_state)
 	/* switch to GIC wakeup source */
 	gpc_select_wakeup_gic(CPU_A55C0 + core_id);
 
+	imx_telem_inc(IMX_TELEM_PSCI_CPU_ON);
+
 	if (boot_stage) {
 		/* SRC config */
 		/* config the MEM LPM */
@@ -717,6 +720,8 @@ void imx_pwr_domain_off(const psci_power_state_t *target_state)
 	unsigned int core_id = MPIDR_AFFLVL1_VAL(mpidr);
 	unsigned int i;
 
+	imx_telem_inc(IMX_TELEM_PSCI_CPU_OFF);
+
 	plat_gic_cpuif_disable();
 	write_clusterpwrdn(DSU_CLUSTER_PWR_OFF);
 
@@ -735,6 +740,7 @@ void imx_pwr_domain_off(const psci_power_state_t *target_state)
 
 void imx_pwr_domain_suspend(const psci_power_state_t *target_state)
 {
+	uint64_t telem_start = imx_telem_now();
 	uint64_t mpidr = read_mpidr_el1();
 	unsigned int core_id = MPIDR_AFFLVL1_VAL(mpidr);
 
@@ -757,6 +763,9 @@ void imx_pwr_domain_suspend(const psci_power_state_t *target_state)
 		}
 	}
 
+	/* The telemetry is in DDR, which may go into retention below */
+	imx_telem_suspend_enter(telem_start);
+
 	if (is_local_state_retn(SYSTEM_PWR_STATE(target_state))) {
 		/*
 		 * if M33 is active to use DRAM and the bus fabric, need to do
@@ -840,6 +849,7 @@ void imx_pwr_domain_suspend(const psci_power_state_t *target_state)
 
 void imx_pwr_domain_suspend_finish(const psci_power_state_t *target_state)
 {
+	uint64_t telem_start = imx_telem_now();
 	uint64_t mpidr = read_mpidr_el1();
 	unsigned int core_id = MPIDR_AFFLVL1_VAL(mpidr);
 
@@ -896,6 +906,8 @@ void imx_pwr_domain_suspend_finish(const psci_power_state_t *target_state)
 		gpc_set_cpu_mode(CPU_A55C0 + core_id, CM_MODE_RUN);
 		plat_gic_cpuif_enable();
 	}
+
+	imx_telem_suspend_exit(telem_start);
 }
 
 void imx_get_sys_suspend_power_state(psci_power_state_t *req_state)
@@ -58,6 +58,37 @@ USE_COHERENT_MEM	:=	0
 PROGRAMMABLE_RESET_ADDRESS :=	1
 COLD_BOOT_SINGLE_CPU	:=	1
 
+# Serve the trivial SiP queries from the leaf SMC fast path
+SMC_LEAF_FASTPATH	:=	1
+
+# Switch between DDR setpoints 0 and 1 by HWFFC without stopping the other cores
+IMX_DDR_HWFFC_NO_PARK	?=	0
+$(eval $(call assert_boolean,IMX_DDR_HWFFC_NO_PARK))
+$(eval $(call add_define,IMX_DDR_HWFFC_NO_PARK))
+
+# Per-core EL3 counters in a DRAM region readable from the normal world
+IMX_TELEMETRY		?=	0
+$(eval $(call assert_boolean,IMX_TELEMETRY))
+$(eval $(call add_define,IMX_TELEMETRY))
+
+ifeq (${IMX_TELEMETRY},1)
+IMX_TELEMETRY_BASE	?=	0x95fff000
+IMX_TELEMETRY_SIZE	?=	0x1000
+$(eval $(call add_define,IMX_TELEMETRY_BASE))
+$(eval $(call add_define,IMX_TELEMETRY_SIZE))
+endif
+
+# Text stats files, e.g. #S/psci, for the debugfs SMC interface
+ifeq (${USE_DEBUGFS},1)
+BL31_CFLAGS		+=	-DPLAT_XLAT_TABLES_DYNAMIC=1
+BL31_SOURCES		+=	plat/imx/common/imx_debugfs.c
+endif
+
+ifneq ($(filter 1,${IMX_TELEMETRY} ${USE_DEBUGFS}),)
+BL31_CFLAGS		+=	-DIMX_TELEM_HOOKS=1
+BL31_SOURCES		+=	plat/imx/common/imx_telemetry.c
+endif
+
 BL32_BASE               ?=      0x96000000
 BL32_SIZE               ?=      0x02000000
 $(eval $(call add_define,BL32_BASE))
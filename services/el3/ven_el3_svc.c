@@ -10,6 +10,7 @@
 #include <common/runtime_svc.h>
 #include <lib/debugfs.h>
 #include <lib/pmf/pmf.h>
+#include <lib/psci/psci_stat_hist.h>
 #include <services/ven_el3_svc.h>
 #include <tools_share/uuid.h>
 
@@ -71,6 +72,17 @@ static uintptr_t ven_el3_svc_handler(unsigned int smc_fid,
 
 #endif /* ENABLE_PMF */
 
+#if PSCI_STAT_HISTOGRAM
+	/*
+	 * Dispatch PSCI_STAT_HISTOGRAM calls to its SMC handler and return
+	 * its return value.
+	 */
+	if (is_psci_stat_hist_fid(smc_fid)) {
+		return psci_stat_hist_smc_handler(smc_fid, x1, x2, x3, x4,
+				cookie, handle, flags);
+	}
+#endif /* PSCI_STAT_HISTOGRAM */
+
 	switch (smc_fid) {
 	case VEN_EL3_SVC_UID:
 		/* Return UID to the caller */
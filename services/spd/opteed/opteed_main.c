@@ -528,8 +528,13 @@ static int32_t opteed_handle_smc_load(uint64_t data_size, uint32_t data_pa)
 	memcpy((void *)image_va, image_ptr, curr_image->size);
 	flush_dcache_range(target_pa, target_size);
 
-	mmap_remove_dynamic_region(mapped_data_va, data_map_size);
-	mmap_remove_dynamic_region(target_va, target_size);
+	const mmap_region_t maps[] = {
+		MAP_REGION(mapped_data_pa, mapped_data_va, data_map_size, 0U),
+		MAP_REGION(target_pa, target_va, target_size, 0U),
+	};
+
+	/* Both regions were mapped above, so the batch cannot partly fail. */
+	(void)mmap_remove_dynamic_regions(maps, ARRAY_SIZE(maps));
 
 	/* Save the non-secure state */
 	cm_el1_sysregs_context_save(NON_SECURE);
@@ -54,16 +54,58 @@ struct trusty_shmem_obj {
 	struct ffa_mtd desc;
 };
 
+/*
+ * Descriptors of up to TRUSTY_SHMEM_SLAB_DESC_SIZE bytes, which covers the
+ * common case of a buffer made of a handful of address ranges, are stored in
+ * fixed size slots carved from the start of the backing store. By default a
+ * quarter of the backing store is used for slots. Larger descriptors, and small
+ * ones once all slots are taken, go to the compacting heap that uses the rest.
+ */
+#ifndef TRUSTY_SHMEM_SLAB_DESC_SIZE
+#define TRUSTY_SHMEM_SLAB_DESC_SIZE 256
+#endif
+
+#define TRUSTY_SHMEM_SLAB_OBJ_SIZE \
+	(offsetof(struct trusty_shmem_obj, desc) + TRUSTY_SHMEM_SLAB_DESC_SIZE)
+
+#ifndef TRUSTY_SHMEM_SLAB_SLOTS
+#define TRUSTY_SHMEM_SLAB_SLOTS \
+	((TRUSTY_SHARED_MEMORY_OBJ_SIZE / 4) / TRUSTY_SHMEM_SLAB_OBJ_SIZE)
+#endif
+
+#define TRUSTY_SHMEM_SLAB_SIZE \
+	(TRUSTY_SHMEM_SLAB_SLOTS * TRUSTY_SHMEM_SLAB_OBJ_SIZE)
+
+CASSERT((TRUSTY_SHMEM_SLAB_SLOTS > 0) &&
+	(TRUSTY_SHMEM_SLAB_SLOTS <= UINT16_MAX) &&
+	(TRUSTY_SHMEM_SLAB_SIZE < TRUSTY_SHARED_MEMORY_OBJ_SIZE),
+	assert_trusty_shmem_slab_size);
+CASSERT((TRUSTY_SHMEM_SLAB_OBJ_SIZE % 8) == 0,
+	assert_trusty_shmem_slab_obj_alignment);
+
 /**
  * struct trusty_shmem_obj_state - Global state.
- * @data:           Backing store for trusty_shmem_obj objects.
+ * @data:           Backing store for trusty_shmem_obj objects allocated from
+ *                  the heap.
  * @allocated:      Number of bytes allocated in @data.
+ * @slab:           Backing store for the fixed size slots.
+ * @slab_allocated: Number of slots in use.
+ * @slab_hwm:       Number of slots that have ever been used. Slots above it
+ *                  are free and have never been touched.
+ * @slab_free:      Stack of free slots below @slab_hwm. The last slot freed is
+ *                  reused first, while its memory is still in the cache.
+ * @slab_free_count: Number of entries in @slab_free.
  * @next_handle:    Handle used for next allocated object.
  * @lock:           Lock protecting all state in this file.
  */
 struct trusty_shmem_obj_state {
 	uint8_t *data;
 	size_t allocated;
+	uint8_t *slab;
+	unsigned int slab_allocated;
+	unsigned int slab_hwm;
+	uint16_t slab_free[TRUSTY_SHMEM_SLAB_SLOTS];
+	unsigned int slab_free_count;
 	uint64_t next_handle;
 	struct spinlock lock;
 };
@@ -102,7 +144,8 @@ __aligned(8) static uint8_t
 	trusty_shmem_objs_data[TRUSTY_SHARED_MEMORY_OBJ_SIZE];
 static struct trusty_shmem_obj_state trusty_shmem_obj_state = {
 	/* initializing data this way keeps the bulk of the state in .bss */
-	.data = trusty_shmem_objs_data,
+	.data = trusty_shmem_objs_data + TRUSTY_SHMEM_SLAB_SIZE,
+	.slab = trusty_shmem_objs_data,
 	/* Set start value for handle so top 32 bits are needed quickly */
 	.next_handle = 0xffffffc0,
 };
@@ -141,12 +184,72 @@ static size_t trusty_shmem_obj_size(size_t desc_size)
 	return desc_size + offsetof(struct trusty_shmem_obj, desc);
 }
 
+/**
+ * trusty_shmem_slab_obj - Get the object stored in a slot.
+ * @state:      Global state.
+ * @slot:       Index of the slot.
+ *
+ * Return: Pointer to the object in @slot.
+ */
+static struct trusty_shmem_obj *
+trusty_shmem_slab_obj(struct trusty_shmem_obj_state *state, unsigned int slot)
+{
+	return (struct trusty_shmem_obj *)(state->slab +
+					   slot * TRUSTY_SHMEM_SLAB_OBJ_SIZE);
+}
+
+/**
+ * trusty_shmem_slab_slot - Get the slot holding an object.
+ * @state:      Global state.
+ * @obj:        Object to check.
+ *
+ * Return: Index of the slot holding @obj, or -1 if @obj was allocated from the
+ *         heap.
+ */
+static int trusty_shmem_slab_slot(struct trusty_shmem_obj_state *state,
+				  struct trusty_shmem_obj *obj)
+{
+	size_t offset = (uint8_t *)obj - state->slab;
+
+	if (((uint8_t *)obj < state->slab) ||
+	    (offset >= TRUSTY_SHMEM_SLAB_SIZE)) {
+		return -1;
+	}
+	return (int)(offset / TRUSTY_SHMEM_SLAB_OBJ_SIZE);
+}
+
+/**
+ * trusty_shmem_slab_alloc - Allocate a slot.
+ * @state:      Global state.
+ *
+ * Return: Pointer to the object in a free slot, or %NULL if all slots are in
+ *         use.
+ */
+static struct trusty_shmem_obj *
+trusty_shmem_slab_alloc(struct trusty_shmem_obj_state *state)
+{
+	unsigned int slot;
+
+	if (state->slab_free_count) {
+		slot = state->slab_free[--state->slab_free_count];
+	} else if (state->slab_hwm < TRUSTY_SHMEM_SLAB_SLOTS) {
+		slot = state->slab_hwm++;
+	} else {
+		return NULL;
+	}
+	state->slab_allocated++;
+	return trusty_shmem_slab_obj(state, slot);
+}
+
 /**
  * trusty_shmem_obj_alloc - Allocate struct trusty_shmem_obj.
  * @state:      Global state.
  * @desc_size:  Size of struct ffa_memory_region_descriptor object that
  *              allocated object will hold.
  *
+ * Small descriptors are put in a slot if one is available, everything else is
+ * allocated from the heap.
+ *
  * Return: Pointer to newly allocated object, or %NULL if there not enough space
  *         left. The returned pointer is only valid while @state is locked, to
  *         used it again after unlocking @state, trusty_shmem_obj_lookup must be
@@ -155,8 +258,20 @@ static size_t trusty_shmem_obj_size(size_t desc_size)
 static struct trusty_shmem_obj *
 trusty_shmem_obj_alloc(struct trusty_shmem_obj_state *state, size_t desc_size)
 {
-	struct trusty_shmem_obj *obj;
-	size_t free = sizeof(trusty_shmem_objs_data) - state->allocated;
+	struct trusty_shmem_obj *obj = NULL;
+	size_t free = sizeof(trusty_shmem_objs_data) - TRUSTY_SHMEM_SLAB_SIZE -
+		      state->allocated;
+
+	if (desc_size <= TRUSTY_SHMEM_SLAB_DESC_SIZE) {
+		obj = trusty_shmem_slab_alloc(state);
+	}
+	if (obj) {
+		obj->desc_size = desc_size;
+		obj->desc_filled = 0;
+		obj->in_use = 0;
+		return obj;
+	}
+
 	if (trusty_shmem_obj_size(desc_size) > free) {
 		NOTICE("%s(0x%zx) failed, free 0x%zx\n",
 		       __func__, desc_size, free);
@@ -186,6 +301,17 @@ trusty_shmem_obj_alloc(struct trusty_shmem_obj_state *state, size_t desc_size)
 static void trusty_shmem_obj_free(struct trusty_shmem_obj_state *state,
 				  struct trusty_shmem_obj *obj)
 {
+	int slot = trusty_shmem_slab_slot(state, obj);
+
+	if (slot >= 0) {
+		/* Slots never move, no need to compact anything. */
+		obj->desc_size = 0;
+		obj->desc.handle = 0;
+		state->slab_free[state->slab_free_count++] = (uint16_t)slot;
+		state->slab_allocated--;
+		return;
+	}
+
 	size_t free_size = trusty_shmem_obj_size(obj->desc_size);
 	uint8_t *shift_dest = (uint8_t *)obj;
 	uint8_t *shift_src = shift_dest + free_size;
@@ -196,17 +322,50 @@ static void trusty_shmem_obj_free(struct trusty_shmem_obj_state *state,
 	state->allocated -= free_size;
 }
 
+/**
+ * trusty_shmem_obj_set_handle - Assign a new unique handle to an object.
+ * @state:      Global state.
+ * @obj:        Object to assign the handle to.
+ *
+ * Handles keep increasing. For objects stored in a slot, the handle is moved
+ * forward to the next value that is congruent to the slot index, so that
+ * trusty_shmem_obj_lookup can find the slot directly from the handle.
+ */
+static void trusty_shmem_obj_set_handle(struct trusty_shmem_obj_state *state,
+					struct trusty_shmem_obj *obj)
+{
+	int slot = trusty_shmem_slab_slot(state, obj);
+	uint64_t handle = state->next_handle;
+
+	if (slot >= 0) {
+		handle += ((uint64_t)slot + TRUSTY_SHMEM_SLAB_SLOTS -
+			   (handle % TRUSTY_SHMEM_SLAB_SLOTS)) %
+			  TRUSTY_SHMEM_SLAB_SLOTS;
+	}
+	obj->desc.handle = handle;
+	state->next_handle = handle + 1;
+}
+
 /**
  * trusty_shmem_obj_lookup - Lookup struct trusty_shmem_obj by handle.
  * @state:      Global state.
  * @handle:     Unique handle of object to return.
  *
+ * The slot the handle maps to is checked first, the heap is only walked if the
+ * object is not there.
+ *
  * Return: struct trusty_shmem_obj_state object with handle matching @handle.
  *         %NULL, if not object in @state->data has a matching handle.
  */
 static struct trusty_shmem_obj *
 trusty_shmem_obj_lookup(struct trusty_shmem_obj_state *state, uint64_t handle)
 {
+	struct trusty_shmem_obj *slab_obj = trusty_shmem_slab_obj(state,
+				(unsigned int)(handle % TRUSTY_SHMEM_SLAB_SLOTS));
+	if (handle && slab_obj->desc_size && slab_obj->desc.handle == handle) {
+		return slab_obj;
+	}
+
 	uint8_t *curr = state->data;
 	while (curr - state->data < state->allocated) {
 		struct trusty_shmem_obj *obj = (struct trusty_shmem_obj *)curr;
@@ -352,7 +511,7 @@ static long trusty_ffa_fill_desc(struct trusty_shmem_client_state *client,
 
 	if (!obj->desc_filled) {
 		/* First fragment, descriptor header has been copied */
-		obj->desc.handle = trusty_shmem_obj_state.next_handle++;
+		trusty_shmem_obj_set_handle(&trusty_shmem_obj_state, obj);
 		obj->desc.flags = mtd_flags;
 		obj->desc.memory_region_attributes |= FFA_MEM_ATTR_NONSECURE;
 	}
@@ -808,6 +967,10 @@ static long trusty_ffa_rxtx_map(struct trusty_shmem_client_state *client,
 		return -EACCES;
 	}
 
+	/*
+	 * The buffers stay mapped until FFA_RXTX_UNMAP and all descriptors go
+	 * through them, so sharing or reclaiming memory never maps anything.
+	 */
 	if (client->identity_mapped) {
 		tx_va = tx_address;
 		rx_va = rx_address;
@@ -864,20 +1027,38 @@ static long trusty_ffa_rxtx_unmap(struct trusty_shmem_client_state *client,
 	}
 
 	if (!client->identity_mapped) {
-		ret = mmap_remove_dynamic_region((uintptr_t)client->tx_buf,
-						 client->buf_size);
-		if (ret) {
-			NOTICE("%s: failed to unmap tx buffer @ %p, size 0x%zx\n",
-			       __func__, client->tx_buf, client->buf_size);
-		}
-		ret = mmap_remove_dynamic_region((uintptr_t)client->rx_buf,
-						 client->buf_size);
+		const mmap_region_t bufs[] = {
+			MAP_REGION((uintptr_t)client->tx_buf,
+				   (uintptr_t)client->tx_buf,
+				   client->buf_size, 0U),
+			MAP_REGION((uintptr_t)client->rx_buf,
+				   (uintptr_t)client->rx_buf,
+				   client->buf_size, 0U),
+		};
+
+		ret = mmap_remove_dynamic_regions(bufs, ARRAY_SIZE(bufs));
 		if (ret) {
-			NOTICE("%s: failed to unmap rx buffer @ %p, size 0x%zx\n",
-			       __func__, client->rx_buf, client->buf_size);
+			/*
+			 * The batch is all-or-nothing, so one missing buffer
+			 * would leave the other one mapped. Unmap whichever
+			 * is still there on its own.
+			 */
+			ret = mmap_remove_dynamic_region((uintptr_t)client->tx_buf,
+							 client->buf_size);
+			if (ret) {
+				NOTICE("%s: failed to unmap tx buffer @ %p, size 0x%zx\n",
+				       __func__, client->tx_buf, client->buf_size);
+			}
+			ret = mmap_remove_dynamic_region((uintptr_t)client->rx_buf,
+							 client->buf_size);
+			if (ret) {
+				NOTICE("%s: failed to unmap rx buffer @ %p, size 0x%zx\n",
+				       __func__, client->rx_buf, client->buf_size);
+			}
 		}
 	}
-	if (trusty_shmem_obj_state.allocated) {
+	if (trusty_shmem_obj_state.allocated ||
+	    trusty_shmem_obj_state.slab_allocated) {
 		WARN("%s: shared memory regions are still active\n", __func__);
 	}
 
@@ -57,6 +57,127 @@ static size_t spmc_shmem_obj_size(size_t desc_size)
 	return desc_size + offsetof(struct spmc_shmem_obj, desc);
 }
 
+/**
+ * spmc_shmem_obj_index_slot - Get the preferred index slot of a handle.
+ * @handle:     Handle of the object.
+ *
+ * Handles are allocated sequentially, so the low bits spread them evenly over
+ * the index.
+ *
+ * Return: Index of the first slot to probe for @handle.
+ */
+static unsigned int spmc_shmem_obj_index_slot(uint64_t handle)
+{
+	return (unsigned int)(handle & (SPMC_SHMEM_OBJ_INDEX_SIZE - 1U));
+}
+
+/**
+ * spmc_shmem_obj_index_find - Find the index entry of a handle.
+ * @state:      Global state.
+ * @handle:     Handle to look for.
+ * @probes:     If not %NULL, incremented by the number of entries inspected.
+ *
+ * Return: Pointer to the index entry for @handle, or %NULL if the handle is not
+ *         in the index.
+ */
+static struct spmc_shmem_obj_index_entry *
+spmc_shmem_obj_index_find(struct spmc_shmem_obj_state *state, uint64_t handle,
+			  uint64_t *probes)
+{
+	unsigned int slot = spmc_shmem_obj_index_slot(handle);
+
+	if (handle == 0U) {
+		return NULL;
+	}
+
+	for (unsigned int i = 0U; i < SPMC_SHMEM_OBJ_INDEX_SIZE; i++) {
+		struct spmc_shmem_obj_index_entry *entry = &state->index[slot];
+
+		if (probes != NULL) {
+			(*probes)++;
+		}
+		if (entry->handle == handle) {
+			return entry;
+		}
+		if (entry->handle == 0U) {
+			break;
+		}
+		slot = (slot + 1U) & (SPMC_SHMEM_OBJ_INDEX_SIZE - 1U);
+	}
+	return NULL;
+}
+
+/**
+ * spmc_shmem_obj_index_set - Point the index entry of a handle to an object.
+ * @state:      Global state.
+ * @obj:        Object holding the handle in @obj->desc.handle.
+ *
+ * Adds a new entry for the handle, or updates the existing one if the handle
+ * is already indexed, e.g. when a descriptor is converted into a new object.
+ *
+ * Return: 0 on success, -ENOMEM if the index is full.
+ */
+static int spmc_shmem_obj_index_set(struct spmc_shmem_obj_state *state,
+				    struct spmc_shmem_obj *obj)
+{
+	uint64_t handle = obj->desc.handle;
+	unsigned int slot = spmc_shmem_obj_index_slot(handle);
+
+	assert(handle != 0U);
+
+	for (unsigned int i = 0U; i < SPMC_SHMEM_OBJ_INDEX_SIZE; i++) {
+		struct spmc_shmem_obj_index_entry *entry = &state->index[slot];
+
+		if ((entry->handle == handle) || (entry->handle == 0U)) {
+			entry->handle = handle;
+			entry->offset = (uint8_t *)obj - state->data;
+			return 0;
+		}
+		slot = (slot + 1U) & (SPMC_SHMEM_OBJ_INDEX_SIZE - 1U);
+	}
+	return -ENOMEM;
+}
+
+/**
+ * spmc_shmem_obj_index_remove - Remove an entry from the index.
+ * @state:      Global state.
+ * @entry:      Entry to remove.
+ *
+ * Entries that follow the removed one in the same probe sequence are shifted
+ * back, so the index never needs tombstones.
+ */
+static void spmc_shmem_obj_index_remove(struct spmc_shmem_obj_state *state,
+					struct spmc_shmem_obj_index_entry *entry)
+{
+	unsigned int hole = (unsigned int)(entry - state->index);
+	unsigned int next = hole;
+
+	state->index[hole].handle = 0U;
+
+	for (;;) {
+		unsigned int home;
+
+		next = (next + 1U) & (SPMC_SHMEM_OBJ_INDEX_SIZE - 1U);
+		if (state->index[next].handle == 0U) {
+			return;
+		}
+
+		/*
+		 * The entry can stay where it is if its preferred slot is
+		 * cyclically in (hole, next].
+		 */
+		home = spmc_shmem_obj_index_slot(state->index[next].handle);
+		if ((hole <= next) ? ((hole < home) && (home <= next)) :
+				     ((hole < home) || (home <= next))) {
+			continue;
+		}
+
+		state->index[hole] = state->index[next];
+		state->index[next].handle = 0U;
+		hole = next;
+	}
+}
+
 /**
  * spmc_shmem_obj_alloc - Allocate struct spmc_shmem_obj.
  * @state:      Global state.
@@ -130,11 +251,48 @@ static void spmc_shmem_obj_free(struct spmc_shmem_obj_state *state,
 	uint8_t *shift_dest = (uint8_t *)obj;
 	uint8_t *shift_src = shift_dest + free_size;
 	size_t shift_size = state->allocated - (shift_src - state->data);
+	struct spmc_shmem_obj_index_entry *entry;
+	uint8_t *curr;
+
+	/*
+	 * Temporary copies of a descriptor share its handle, only drop the
+	 * index entry if it refers to this very object.
+	 */
+	entry = spmc_shmem_obj_index_find(state, obj->desc.handle, NULL);
+	if ((entry != NULL) &&
+	    (entry->offset == (size_t)(shift_dest - state->data))) {
+		spmc_shmem_obj_index_remove(state, entry);
+	}
 
 	if (shift_size != 0U) {
 		memmove(shift_dest, shift_src, shift_size);
 	}
 	state->allocated -= free_size;
+
+	/* Fix up the index entries of the objects that have been moved. */
+	for (curr = shift_dest; curr < shift_dest + shift_size;
+	     curr += spmc_shmem_obj_size(((struct spmc_shmem_obj *)curr)->desc_size)) {
+		struct spmc_shmem_obj *moved = (struct spmc_shmem_obj *)curr;
+
+		entry = spmc_shmem_obj_index_find(state, moved->desc.handle,
+						  NULL);
+		if ((entry != NULL) &&
+		    (entry->offset == (size_t)(curr - state->data) + free_size)) {
+			entry->offset -= free_size;
+		}
+	}
+}
+
+/**
+ * spmc_shmem_obj_stats_print - Print the lookup statistics.
+ * @state:      Global state.
+ */
+static void spmc_shmem_obj_stats_print(struct spmc_shmem_obj_state *state)
+{
+	VERBOSE("shmem: %u live objects, %" PRIu64 " lookups, %" PRIu64
+		" index probes, %" PRIu64 " datastore walks\n",
+		state->live_objs, state->lookups, state->lookup_probes,
+		state->lookup_misses);
 }
 
 /**
@@ -142,16 +300,34 @@ static void spmc_shmem_obj_free(struct spmc_shmem_obj_state *state,
  * @state:      Global state.
  * @handle:     Unique handle of object to return.
  *
+ * Counts the lookup, the index entries it inspects and whether it has to walk
+ * the datastore in @state, to measure how well the index serves lookups.
+ *
  * Return: struct spmc_shmem_obj_state object with handle matching @handle.
  *         %NULL, if not object in @state->data has a matching handle.
  */
 static struct spmc_shmem_obj *
 spmc_shmem_obj_lookup(struct spmc_shmem_obj_state *state, uint64_t handle)
 {
+	struct spmc_shmem_obj_index_entry *entry;
+	struct spmc_shmem_obj *obj;
 	uint8_t *curr = state->data;
 
+	state->lookups++;
+	entry = spmc_shmem_obj_index_find(state, handle, &state->lookup_probes);
+	if (entry != NULL) {
+		obj = (struct spmc_shmem_obj *)(state->data + entry->offset);
+		assert(obj->desc.handle == handle);
+		return obj;
+	}
+
+	/*
+	 * Objects given their handle while the index was full are not in it,
+	 * so fall back to walking the datastore.
+	 */
+	state->lookup_misses++;
 	while (curr - state->data < state->allocated) {
-		struct spmc_shmem_obj *obj = (struct spmc_shmem_obj *)curr;
+		obj = (struct spmc_shmem_obj *)curr;
 
 		if (obj->desc.handle == handle) {
 			return obj;
@@ -1070,6 +1246,14 @@ static long spmc_ffa_fill_desc(struct mailbox *mbox,
 
 		obj->desc.handle = spmc_shmem_obj_state.next_handle++;
 		obj->desc.flags |= mtd_flag;
+		spmc_shmem_obj_state.live_objs++;
+
+		if (spmc_shmem_obj_index_set(&spmc_shmem_obj_state,
+					     obj) != 0) {
+			VERBOSE("%s: handle index full, 0x%" PRIx64
+				" not indexed\n", __func__, obj->desc.handle);
+			spmc_shmem_obj_stats_print(&spmc_shmem_obj_state);
+		}
 	}
 
 	obj->desc_filled += fragment_length;
@@ -1134,9 +1318,11 @@ static long spmc_ffa_fill_desc(struct mailbox *mbox,
 
 		/*
 		 * We're finished with the v1.0 descriptor so free it
-		 * and continue our checks with the new v1.1 descriptor.
+		 * and continue our checks with the new v1.1 descriptor,
+		 * which takes over the handle of the original one.
 		 */
 		mem_handle = obj->desc.handle;
+		(void)spmc_shmem_obj_index_set(&spmc_shmem_obj_state, v1_1_obj);
 		spmc_shmem_obj_free(&spmc_shmem_obj_state, obj);
 		obj = spmc_shmem_obj_lookup(&spmc_shmem_obj_state, mem_handle);
 		if (obj == NULL) {
@@ -1158,6 +1344,10 @@ static long spmc_ffa_fill_desc(struct mailbox *mbox,
 
 err_bad_desc:
 err_arg:
+	if (obj->desc_filled != 0U) {
+		/* The object has been given a handle */
+		spmc_shmem_obj_state.live_objs--;
+	}
 	spmc_shmem_obj_free(&spmc_shmem_obj_state, obj);
 	return spmc_ffa_error_return(smc_handle, ret);
 }
@@ -1924,6 +2114,8 @@ int spmc_ffa_mem_reclaim(uint32_t smc_fid,
 	}
 
 	spmc_shmem_obj_free(&spmc_shmem_obj_state, obj);
+	spmc_shmem_obj_state.live_objs--;
+	spmc_shmem_obj_stats_print(&spmc_shmem_obj_state);
 	spin_unlock(&spmc_shmem_obj_state.lock);
 
 	SMC_RET1(handle, FFA_SUCCESS_SMC32);
@@ -7,8 +7,25 @@
 #ifndef SPMC_SHARED_MEM_H
 #define SPMC_SHARED_MEM_H
 
+#include <platform_def.h>
+
 #include <services/el3_spmc_ffa_memory.h>
 
+/*
+ * Size of the handle index of the shared memory objects, which must be a power
+ * of two. Objects given a handle while the index is full are not indexed and
+ * are found by walking the datastore instead, so it does not bound the number
+ * of live objects. Platforms can override it with
+ * PLAT_SPMC_SHMEM_OBJ_INDEX_SIZE.
+ */
+#ifdef PLAT_SPMC_SHMEM_OBJ_INDEX_SIZE
+#define SPMC_SHMEM_OBJ_INDEX_SIZE	PLAT_SPMC_SHMEM_OBJ_INDEX_SIZE
+#else
+#define SPMC_SHMEM_OBJ_INDEX_SIZE	U(64)
+#endif
+CASSERT(IS_POWER_OF_TWO(SPMC_SHMEM_OBJ_INDEX_SIZE),
+	assert_spmc_shmem_obj_index_size_power_of_two);
+
 /**
  * struct ffa_mem_relinquish_descriptor - Relinquish request descriptor.
  * @handle:
@@ -31,12 +48,28 @@ struct ffa_mem_relinquish_descriptor {
 CASSERT(sizeof(struct ffa_mem_relinquish_descriptor) == 16,
 	assert_ffa_mem_relinquish_descriptor_size_mismatch);
 
+/**
+ * struct spmc_shmem_obj_index_entry - Handle index entry.
+ * @handle:         Handle of the indexed object, 0 if the entry is free.
+ * @offset:         Offset of the object in the backing store.
+ */
+struct spmc_shmem_obj_index_entry {
+	uint64_t handle;
+	size_t offset;
+};
+
 /**
  * struct spmc_shmem_obj_state - Global state.
  * @data:           Backing store for spmc_shmem_obj objects.
  * @data_size:      The size allocated for the backing store.
  * @allocated:      Number of bytes allocated in @data.
  * @next_handle:    Handle used for next allocated object.
+ * @index:          Open addressed hash table from handle to object offset.
+ * @live_objs:      Number of objects currently holding a handle.
+ * @lookups:        Number of handle lookups performed.
+ * @lookup_probes:  Number of index entries inspected by those lookups.
+ * @lookup_misses:  Number of lookups that missed the index and walked the
+ *                  datastore.
  * @lock:           Lock protecting all state in this file.
  */
 struct spmc_shmem_obj_state {
@@ -44,6 +77,11 @@ struct spmc_shmem_obj_state {
 	size_t data_size;
 	size_t allocated;
 	uint64_t next_handle;
+	struct spmc_shmem_obj_index_entry index[SPMC_SHMEM_OBJ_INDEX_SIZE];
+	unsigned int live_objs;
+	uint64_t lookups;
+	uint64_t lookup_probes;
+	uint64_t lookup_misses;
 	spinlock_t lock;
 };
 
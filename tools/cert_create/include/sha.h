@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2017, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -7,6 +7,13 @@
 #ifndef SHA_H
 #define SHA_H
 
+/* Size of the largest digest, which is SHA-512 */
+#define SHA_MAX_DIGEST_LENGTH	64
+
 int sha_file(int md_alg, const char *filename, unsigned char *md);
+int sha_cache_add(int md_alg, const char *filename);
+int sha_cache_update(unsigned int jobs);
+int sha_file_cached(int md_alg, const char *filename, unsigned char *md);
+void sha_cache_cleanup(void);
 
 #endif /* SHA_H */
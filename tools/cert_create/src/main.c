@@ -13,6 +13,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
 
 #include <openssl/conf.h>
 #include <openssl/engine.h>
@@ -67,6 +70,8 @@ static int key_size;
 static int new_keys;
 static int save_keys;
 static int print_cert;
+static const char *batch_fn;
+static unsigned int batch_jobs;
 
 static const char build_msg[] = "Built : " __TIME__ ", " __DATE__;
 static const char platform_msg[] = PLAT_MSG;
@@ -253,6 +258,574 @@ static void check_cmd_params(void)
 	}
 }
 
+static void load_key(cert_key_t *key)
+{
+	unsigned int err_code;
+
+#if !USING_OPENSSL3
+	if (!key_new(key)) {
+		ERROR("Failed to allocate key container\n");
+		exit(1);
+	}
+#endif
+
+	/* First try to load the key from disk */
+	err_code = key_load(key);
+	if (err_code == KEY_ERR_NONE) {
+		/* Key loaded successfully */
+		return;
+	}
+
+	/* Key not loaded. Check the error code */
+	if (err_code == KEY_ERR_LOAD) {
+		/* File exists, but it does not contain a valid private
+		 * key. Abort. */
+		ERROR("Error loading '%s'\n", key->fn);
+		exit(1);
+	}
+
+	/* File does not exist, could not be opened or no filename was
+	 * given */
+	if (new_keys) {
+		/* Try to create a new key */
+		NOTICE("Creating new key for '%s'\n", key->desc);
+		if (!key_create(key, key_alg, key_size)) {
+			ERROR("Error creating key '%s'\n", key->desc);
+			exit(1);
+		}
+	} else {
+		if (err_code == KEY_ERR_OPEN) {
+			ERROR("Error opening '%s'\n", key->fn);
+		} else {
+			ERROR("Key '%s' not specified\n", key->desc);
+		}
+		exit(1);
+	}
+}
+
+static void create_certs(const EVP_MD *md_info, unsigned int md_len)
+{
+	STACK_OF(X509_EXTENSION) * sk;
+	X509_EXTENSION *cert_ext = NULL;
+	ext_t *ext;
+	cert_t *cert;
+	int i, j, ext_nid, nvctr;
+	unsigned char md[SHA512_DIGEST_LENGTH];
+
+	for (i = 0 ; i < num_certs ; i++) {
+
+		cert = &certs[i];
+
+		if (cert->fn == NULL) {
+			/* Certificate not requested. Skip to the next one */
+			continue;
+		}
+
+		/* Create a new stack of extensions. This stack will be used
+		 * to create the certificate */
+		CHECK_NULL(sk, sk_X509_EXTENSION_new_null());
+
+		for (j = 0 ; j < cert->num_ext ; j++) {
+
+			ext = &extensions[cert->ext[j]];
+
+			/* Get OpenSSL internal ID for this extension */
+			CHECK_OID(ext_nid, ext->oid);
+
+			/*
+			 * Three types of extensions are currently supported:
+			 *     - EXT_TYPE_NVCOUNTER
+			 *     - EXT_TYPE_HASH
+			 *     - EXT_TYPE_PKEY
+			 */
+			switch (ext->type) {
+			case EXT_TYPE_NVCOUNTER:
+				if (ext->optional && ext->arg == NULL) {
+					/* Skip this NVCounter */
+					continue;
+				} else {
+					/* Checked by `check_cmd_params` */
+					assert(ext->arg != NULL);
+					nvctr = atoi(ext->arg);
+					CHECK_NULL(cert_ext, ext_new_nvcounter(ext_nid,
+						EXT_CRIT, nvctr));
+				}
+				break;
+			case EXT_TYPE_HASH:
+				if (ext->arg == NULL) {
+					if (ext->optional) {
+						/* Include a hash filled with zeros */
+						memset(md, 0x0, SHA512_DIGEST_LENGTH);
+					} else {
+						/* Do not include this hash in the certificate */
+						continue;
+					}
+				} else {
+					/* Calculate the hash of the file */
+					if (!sha_file_cached(hash_alg, ext->arg, md)) {
+						ERROR("Cannot calculate hash of %s\n",
+							ext->arg);
+						exit(1);
+					}
+				}
+				CHECK_NULL(cert_ext, ext_new_hash(ext_nid,
+						EXT_CRIT, md_info, md,
+						md_len));
+				break;
+			case EXT_TYPE_PKEY:
+				CHECK_NULL(cert_ext, ext_new_key(ext_nid,
+					EXT_CRIT, keys[ext->attr.key].key));
+				break;
+			default:
+				ERROR("Unknown extension type '%d' in %s\n",
+						ext->type, cert->cn);
+				exit(1);
+			}
+
+			/* Push the extension into the stack */
+			sk_X509_EXTENSION_push(sk, cert_ext);
+		}
+
+		/* Create certificate. Signed with corresponding key */
+		if (!cert_new(hash_alg, cert, VAL_DAYS, 0, sk)) {
+			ERROR("Cannot create %s\n", cert->cn);
+			exit(1);
+		}
+
+		for (cert_ext = sk_X509_EXTENSION_pop(sk); cert_ext != NULL;
+				cert_ext = sk_X509_EXTENSION_pop(sk)) {
+			X509_EXTENSION_free(cert_ext);
+		}
+
+		sk_X509_EXTENSION_free(sk);
+	}
+}
+
+static void save_certs(void)
+{
+	FILE *file;
+	int i;
+
+	/* Print the certificates */
+	if (print_cert) {
+		for (i = 0 ; i < num_certs ; i++) {
+			if (!certs[i].x) {
+				continue;
+			}
+			printf("\n\n=====================================\n\n");
+			X509_print_fp(stdout, certs[i].x);
+		}
+	}
+
+	/* Save created certificates to files */
+	for (i = 0 ; i < num_certs ; i++) {
+		if (certs[i].x && certs[i].fn) {
+			file = fopen(certs[i].fn, "w");
+			if (file != NULL) {
+				i2d_X509_fp(file, certs[i].x);
+				fclose(file);
+			} else {
+				ERROR("Cannot create file %s\n", certs[i].fn);
+			}
+		}
+	}
+}
+
+/*
+ * Batch mode
+ *
+ * The batch file lists one variant per line, as the image, key and
+ * certificate options to generate its chain of trust with. Options given on
+ * the command line apply to all the variants. Empty lines and lines starting
+ * with '#' are ignored.
+ *
+ * Keys are loaded, and images hashed, once for all the variants. The
+ * certificates of the variants are then generated in parallel processes.
+ */
+typedef struct variant_s {
+	unsigned int line;	/* Line in the batch file */
+	int argc;
+	char **argv;		/* Options, after a dummy program name */
+	char *buf;		/* Line which argv points into */
+	pid_t pid;
+} variant_t;
+
+/* Key loaded or created once and shared by all the variants */
+typedef struct key_cache_s {
+	const char *fn;		/* File name, or NULL for a new key */
+	int idx;		/* Index of the key, for new keys */
+	EVP_PKEY *key;
+} key_cache_t;
+
+/* Certificate file written by a variant */
+typedef struct cert_out_s {
+	const char *fn;
+	unsigned int line;	/* Line of the variant in the batch file */
+} cert_out_t;
+
+static variant_t *variants;
+static unsigned int num_variants;
+static cert_out_t *cert_outs;
+static unsigned int num_cert_outs;
+static key_cache_t *key_cache;
+static unsigned int num_key_cache;
+
+/* Values given on the command line, restored before each variant */
+static const char **base_ext_arg;
+static char **base_key_fn;
+static const char **base_cert_fn;
+
+static unsigned long long time_ms(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000ULL) + (ts.tv_nsec / 1000000);
+}
+
+static void read_batch_file(void)
+{
+	FILE *file;
+	char *line = NULL, *tok;
+	size_t len = 0;
+	unsigned int line_num = 0;
+	variant_t *v;
+
+	file = fopen(batch_fn, "r");
+	if (file == NULL) {
+		ERROR("Cannot open %s\n", batch_fn);
+		exit(1);
+	}
+
+	while (getline(&line, &len, file) != -1) {
+		line_num++;
+
+		tok = line + strspn(line, " \t\r\n");
+		if ((*tok == '\0') || (*tok == '#')) {
+			continue;
+		}
+
+		CHECK_NULL(variants, realloc(variants,
+			(num_variants + 1) * sizeof(*variants)));
+		v = &variants[num_variants++];
+		memset(v, 0, sizeof(*v));
+		v->line = line_num;
+		CHECK_NULL(v->buf, strdup(line));
+
+		for (tok = strtok(v->buf, " \t\r\n"); ;
+		     tok = strtok(NULL, " \t\r\n")) {
+			CHECK_NULL(v->argv, realloc(v->argv,
+				(v->argc + 2) * sizeof(*v->argv)));
+			if (v->argc == 0) {
+				v->argv[v->argc++] = (char *)batch_fn;
+			}
+			v->argv[v->argc] = tok;
+			if (tok == NULL) {
+				break;
+			}
+			v->argc++;
+		}
+	}
+
+	free(line);
+	fclose(file);
+
+	if (num_variants == 0) {
+		ERROR("No variants in %s\n", batch_fn);
+		exit(1);
+	}
+}
+
+static void save_base_options(void)
+{
+	int i;
+
+	CHECK_NULL(base_ext_arg, calloc(num_extensions, sizeof(*base_ext_arg)));
+	CHECK_NULL(base_key_fn, calloc(num_keys, sizeof(*base_key_fn)));
+	CHECK_NULL(base_cert_fn, calloc(num_certs, sizeof(*base_cert_fn)));
+
+	for (i = 0; i < num_extensions; i++) {
+		base_ext_arg[i] = extensions[i].arg;
+	}
+	for (i = 0; i < num_keys; i++) {
+		base_key_fn[i] = keys[i].fn;
+	}
+	for (i = 0; i < num_certs; i++) {
+		base_cert_fn[i] = certs[i].fn;
+	}
+}
+
+static void restore_base_options(void)
+{
+	int i;
+
+	for (i = 0; i < num_extensions; i++) {
+		extensions[i].arg = base_ext_arg[i];
+	}
+	for (i = 0; i < num_keys; i++) {
+		keys[i].fn = base_key_fn[i];
+		keys[i].key = NULL;
+	}
+	for (i = 0; i < num_certs; i++) {
+		certs[i].fn = base_cert_fn[i];
+		X509_free(certs[i].x);
+		certs[i].x = NULL;
+	}
+}
+
+static void apply_variant(const variant_t *v, const struct option *cmd_opt)
+{
+	int c, opt_idx = 0;
+	const char *cur_opt;
+
+	restore_base_options();
+
+	/* Rescan from the start of the new argument vector */
+	optind = 0;
+	while ((c = getopt_long(v->argc, v->argv, "", cmd_opt,
+				&opt_idx)) != -1) {
+		switch (c) {
+		case CMD_OPT_EXT:
+			cur_opt = cmd_opt_get_name(opt_idx);
+			ext_get_by_opt(cur_opt)->arg = optarg;
+			break;
+		case CMD_OPT_KEY:
+			cur_opt = cmd_opt_get_name(opt_idx);
+			key_get_by_opt(cur_opt)->fn = optarg;
+			break;
+		case CMD_OPT_CERT:
+			cur_opt = cmd_opt_get_name(opt_idx);
+			cert_get_by_opt(cur_opt)->fn = optarg;
+			break;
+		default:
+			ERROR("%s:%u: only image, key and certificate options can be given per variant\n",
+			      batch_fn, v->line);
+			exit(1);
+		}
+	}
+
+	if (optind != v->argc) {
+		ERROR("%s:%u: unexpected argument '%s'\n", batch_fn, v->line,
+		      v->argv[optind]);
+		exit(1);
+	}
+}
+
+/*
+ * Record the certificate files of the current variant. Variants are signed in
+ * parallel and each of them writes all its certificates, so a file that is
+ * shared with a previous variant would be written several times, concurrently
+ * and with different contents.
+ */
+static void add_cert_outputs(const variant_t *v)
+{
+	unsigned int i;
+	int j;
+
+	for (j = 0; j < num_certs; j++) {
+		if (certs[j].fn == NULL) {
+			continue;
+		}
+
+		for (i = 0; i < num_cert_outs; i++) {
+			if (strcmp(cert_outs[i].fn, certs[j].fn) == 0) {
+				ERROR("%s:%u: %s is also written by the variant on line %u\n",
+				      batch_fn, v->line, certs[j].fn,
+				      cert_outs[i].line);
+				exit(1);
+			}
+		}
+
+		CHECK_NULL(cert_outs, realloc(cert_outs,
+			(num_cert_outs + 1) * sizeof(*cert_outs)));
+		cert_outs[num_cert_outs].fn = certs[j].fn;
+		cert_outs[num_cert_outs].line = v->line;
+		num_cert_outs++;
+	}
+}
+
+/* Get key 'idx' of the current variant, loading or creating it only once */
+static EVP_PKEY *get_cached_key(int idx)
+{
+	const char *fn = keys[idx].fn;
+	key_cache_t *entry;
+	cert_key_t key;
+	unsigned int i;
+
+	for (i = 0; i < num_key_cache; i++) {
+		entry = &key_cache[i];
+		if ((fn != NULL) ? ((entry->fn != NULL) &&
+				    (strcmp(entry->fn, fn) == 0)) :
+				   ((entry->fn == NULL) && (entry->idx == idx))) {
+			return entry->key;
+		}
+	}
+
+	key = keys[idx];
+	key.key = NULL;
+	load_key(&key);
+
+	CHECK_NULL(key_cache, realloc(key_cache,
+		(num_key_cache + 1) * sizeof(*key_cache)));
+	entry = &key_cache[num_key_cache++];
+	entry->fn = fn;
+	entry->idx = idx;
+	entry->key = key.key;
+
+	return entry->key;
+}
+
+static void sign_variant(const variant_t *v, const struct option *cmd_opt,
+			 const EVP_MD *md_info, unsigned int md_len)
+{
+	int i;
+
+	apply_variant(v, cmd_opt);
+	for (i = 0; i < num_keys; i++) {
+		keys[i].key = get_cached_key(i);
+	}
+
+	create_certs(md_info, md_len);
+	save_certs();
+}
+
+static int run_batch(const struct option *cmd_opt, const EVP_MD *md_info,
+		     unsigned int md_len)
+{
+	unsigned long long start;
+	unsigned int i, running = 0, failed = 0, jobs = batch_jobs;
+	int j, k, status, use_fork = 1;
+	variant_t *v;
+	ext_t *ext;
+	pid_t pid;
+
+	if (save_keys) {
+		ERROR("Keys cannot be saved in batch mode\n");
+		exit(1);
+	}
+
+	if (jobs == 0U) {
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+		jobs = (cpus > 0) ? (unsigned int)cpus : 1U;
+	}
+
+	read_batch_file();
+	save_base_options();
+
+	/*
+	 * Check each variant, then load its keys and queue its images to be
+	 * hashed, unless this was done for a previous variant.
+	 */
+	start = time_ms();
+	for (i = 0; i < num_variants; i++) {
+		v = &variants[i];
+		apply_variant(v, cmd_opt);
+		check_cmd_params();
+		add_cert_outputs(v);
+
+		for (j = 0; j < num_keys; j++) {
+			if ((keys[j].fn != NULL) &&
+			    (strncmp(keys[j].fn, "pkcs11:", 7) == 0)) {
+				/* PKCS#11 sessions do not survive fork() */
+				use_fork = 0;
+			}
+			(void)get_cached_key(j);
+		}
+
+		for (j = 0; j < num_certs; j++) {
+			if (certs[j].fn == NULL) {
+				continue;
+			}
+			for (k = 0; k < certs[j].num_ext; k++) {
+				ext = &extensions[certs[j].ext[k]];
+				if ((ext->type == EXT_TYPE_HASH) &&
+				    (ext->arg != NULL) &&
+				    !sha_cache_add(hash_alg, ext->arg)) {
+					exit(1);
+				}
+			}
+		}
+	}
+	NOTICE("Loaded %u keys for %u variants in %llu ms\n", num_key_cache,
+	       num_variants, time_ms() - start);
+
+	start = time_ms();
+	if (!sha_cache_update(jobs)) {
+		exit(1);
+	}
+	NOTICE("Hashed the images of %u variants in %llu ms\n", num_variants,
+	       time_ms() - start);
+
+	start = time_ms();
+	if (!use_fork || (jobs == 1U)) {
+		for (i = 0; i < num_variants; i++) {
+			sign_variant(&variants[i], cmd_opt, md_info, md_len);
+		}
+		jobs = 1U;
+	} else {
+		/* The children must not flush what the parent has buffered */
+		fflush(stdout);
+
+		for (i = 0; (i < num_variants) || (running != 0U); ) {
+			if ((i < num_variants) && (running < jobs)) {
+				v = &variants[i++];
+				pid = fork();
+				if (pid == 0) {
+					sign_variant(v, cmd_opt, md_info,
+						     md_len);
+					fflush(stdout);
+					_exit(0);
+				} else if (pid < 0) {
+					ERROR("Cannot start job for %s:%u\n",
+					      batch_fn, v->line);
+					exit(1);
+				}
+				v->pid = pid;
+				running++;
+				continue;
+			}
+
+			pid = wait(&status);
+			if (pid < 0) {
+				ERROR("Cannot wait for jobs\n");
+				exit(1);
+			}
+			running--;
+
+			if (!WIFEXITED(status) || (WEXITSTATUS(status) != 0)) {
+				for (v = variants; v->pid != pid; v++)
+					;
+				ERROR("Failed to generate the certificates of %s:%u\n",
+				      batch_fn, v->line);
+				failed++;
+			}
+		}
+	}
+	NOTICE("Generated the certificates of %u variants in %llu ms using %u jobs\n",
+	       num_variants, time_ms() - start, jobs);
+
+	/* Give the command line values back for them to be freed */
+	restore_base_options();
+
+	for (i = 0; i < num_key_cache; i++) {
+		EVP_PKEY_free(key_cache[i].key);
+	}
+	free(key_cache);
+	for (i = 0; i < num_variants; i++) {
+		free(variants[i].argv);
+		free(variants[i].buf);
+	}
+	free(variants);
+	free(cert_outs);
+	free(base_ext_arg);
+	free(base_key_fn);
+	free(base_cert_fn);
+	sha_cache_cleanup();
+
+	return (failed == 0U) ? 0 : 1;
+}
+
 /* Common command line options */
 static const cmd_opt_t common_cmd_opt[] = {
 	{
@@ -287,23 +860,27 @@ static const cmd_opt_t common_cmd_opt[] = {
 	{
 		{ "print-cert", no_argument, NULL, 'p' },
 		"Print the certificates in the standard output"
+	},
+	{
+		{ "batch", required_argument, NULL, 'B' },
+		"Generate the certificates of several variants, each given as a line of options in a file"
+	},
+	{
+		{ "jobs", required_argument, NULL, 'j' },
+		"Number of variants processed in parallel in batch mode (default: number of CPUs)"
 	}
 };
 
 int main(int argc, char *argv[])
 {
-	STACK_OF(X509_EXTENSION) * sk;
-	X509_EXTENSION *cert_ext = NULL;
 	ext_t *ext;
 	cert_key_t *key;
 	cert_t *cert;
-	FILE *file;
-	int i, j, ext_nid, nvctr;
+	int i, ret = 0;
 	int c, opt_idx = 0;
 	const struct option *cmd_opt;
 	const char *cur_opt;
-	unsigned int err_code;
-	unsigned char md[SHA512_DIGEST_LENGTH];
+	char *end;
 	unsigned int  md_len;
 	const EVP_MD *md_info;
 
@@ -343,7 +920,7 @@ int main(int argc, char *argv[])
 
 	while (1) {
 		/* getopt_long stores the option index here. */
-		c = getopt_long(argc, argv, "a:b:hknps:", cmd_opt, &opt_idx);
+		c = getopt_long(argc, argv, "a:b:B:hj:knps:", cmd_opt, &opt_idx);
 
 		/* Detect the end of the options. */
 		if (c == -1) {
@@ -365,9 +942,19 @@ int main(int argc, char *argv[])
 				exit(1);
 			}
 			break;
+		case 'B':
+			batch_fn = optarg;
+			break;
 		case 'h':
 			print_help(argv[0], cmd_opt);
 			exit(0);
+		case 'j':
+			batch_jobs = strtoul(optarg, &end, 10);
+			if ((*end != '\0') || (batch_jobs == 0U)) {
+				ERROR("Invalid number of jobs '%s'\n", optarg);
+				exit(1);
+			}
+			break;
 		case 'k':
 			save_keys = 1;
 			break;
@@ -411,9 +998,6 @@ int main(int argc, char *argv[])
 		key_size = KEY_SIZES[key_alg][0];
 	}
 
-	/* Check command line arguments */
-	check_cmd_params();
-
 	/* Indicate SHA as image hash algorithm in the certificate
 	 * extension */
 	if (hash_alg == HASH_ALG_SHA384) {
@@ -427,168 +1011,30 @@ int main(int argc, char *argv[])
 		md_len  = SHA256_DIGEST_LENGTH;
 	}
 
-	/* Load private keys from files (or generate new ones) */
-	for (i = 0 ; i < num_keys ; i++) {
-#if !USING_OPENSSL3
-		if (!key_new(&keys[i])) {
-			ERROR("Failed to allocate key container\n");
-			exit(1);
-		}
-#endif
-
-		/* First try to load the key from disk */
-		err_code = key_load(&keys[i]);
-		if (err_code == KEY_ERR_NONE) {
-			/* Key loaded successfully */
-			continue;
-		}
-
-		/* Key not loaded. Check the error code */
-		if (err_code == KEY_ERR_LOAD) {
-			/* File exists, but it does not contain a valid private
-			 * key. Abort. */
-			ERROR("Error loading '%s'\n", keys[i].fn);
-			exit(1);
-		}
-
-		/* File does not exist, could not be opened or no filename was
-		 * given */
-		if (new_keys) {
-			/* Try to create a new key */
-			NOTICE("Creating new key for '%s'\n", keys[i].desc);
-			if (!key_create(&keys[i], key_alg, key_size)) {
-				ERROR("Error creating key '%s'\n", keys[i].desc);
-				exit(1);
-			}
-		} else {
-			if (err_code == KEY_ERR_OPEN) {
-				ERROR("Error opening '%s'\n", keys[i].fn);
-			} else {
-				ERROR("Key '%s' not specified\n", keys[i].desc);
-			}
-			exit(1);
-		}
-	}
-
-	/* Create the certificates */
-	for (i = 0 ; i < num_certs ; i++) {
-
-		cert = &certs[i];
+	if (batch_fn != NULL) {
+		/* Generate the certificates of all the variants */
+		ret = run_batch(cmd_opt, md_info, md_len);
+	} else {
+		/* Check command line arguments */
+		check_cmd_params();
 
-		if (cert->fn == NULL) {
-			/* Certificate not requested. Skip to the next one */
-			continue;
+		/* Load private keys from files (or generate new ones) */
+		for (i = 0 ; i < num_keys ; i++) {
+			load_key(&keys[i]);
 		}
 
-		/* Create a new stack of extensions. This stack will be used
-		 * to create the certificate */
-		CHECK_NULL(sk, sk_X509_EXTENSION_new_null());
-
-		for (j = 0 ; j < cert->num_ext ; j++) {
-
-			ext = &extensions[cert->ext[j]];
+		/* Create the certificates */
+		create_certs(md_info, md_len);
 
-			/* Get OpenSSL internal ID for this extension */
-			CHECK_OID(ext_nid, ext->oid);
+		/* Print and save the certificates */
+		save_certs();
 
-			/*
-			 * Three types of extensions are currently supported:
-			 *     - EXT_TYPE_NVCOUNTER
-			 *     - EXT_TYPE_HASH
-			 *     - EXT_TYPE_PKEY
-			 */
-			switch (ext->type) {
-			case EXT_TYPE_NVCOUNTER:
-				if (ext->optional && ext->arg == NULL) {
-					/* Skip this NVCounter */
-					continue;
-				} else {
-					/* Checked by `check_cmd_params` */
-					assert(ext->arg != NULL);
-					nvctr = atoi(ext->arg);
-					CHECK_NULL(cert_ext, ext_new_nvcounter(ext_nid,
-						EXT_CRIT, nvctr));
+		/* Save keys */
+		if (save_keys) {
+			for (i = 0 ; i < num_keys ; i++) {
+				if (!key_store(&keys[i])) {
+					ERROR("Cannot save %s\n", keys[i].desc);
 				}
-				break;
-			case EXT_TYPE_HASH:
-				if (ext->arg == NULL) {
-					if (ext->optional) {
-						/* Include a hash filled with zeros */
-						memset(md, 0x0, SHA512_DIGEST_LENGTH);
-					} else {
-						/* Do not include this hash in the certificate */
-						continue;
-					}
-				} else {
-					/* Calculate the hash of the file */
-					if (!sha_file(hash_alg, ext->arg, md)) {
-						ERROR("Cannot calculate hash of %s\n",
-							ext->arg);
-						exit(1);
-					}
-				}
-				CHECK_NULL(cert_ext, ext_new_hash(ext_nid,
-						EXT_CRIT, md_info, md,
-						md_len));
-				break;
-			case EXT_TYPE_PKEY:
-				CHECK_NULL(cert_ext, ext_new_key(ext_nid,
-					EXT_CRIT, keys[ext->attr.key].key));
-				break;
-			default:
-				ERROR("Unknown extension type '%d' in %s\n",
-						ext->type, cert->cn);
-				exit(1);
-			}
-
-			/* Push the extension into the stack */
-			sk_X509_EXTENSION_push(sk, cert_ext);
-		}
-
-		/* Create certificate. Signed with corresponding key */
-		if (!cert_new(hash_alg, cert, VAL_DAYS, 0, sk)) {
-			ERROR("Cannot create %s\n", cert->cn);
-			exit(1);
-		}
-
-		for (cert_ext = sk_X509_EXTENSION_pop(sk); cert_ext != NULL;
-				cert_ext = sk_X509_EXTENSION_pop(sk)) {
-			X509_EXTENSION_free(cert_ext);
-		}
-
-		sk_X509_EXTENSION_free(sk);
-	}
-
-
-	/* Print the certificates */
-	if (print_cert) {
-		for (i = 0 ; i < num_certs ; i++) {
-			if (!certs[i].x) {
-				continue;
-			}
-			printf("\n\n=====================================\n\n");
-			X509_print_fp(stdout, certs[i].x);
-		}
-	}
-
-	/* Save created certificates to files */
-	for (i = 0 ; i < num_certs ; i++) {
-		if (certs[i].x && certs[i].fn) {
-			file = fopen(certs[i].fn, "w");
-			if (file != NULL) {
-				i2d_X509_fp(file, certs[i].x);
-				fclose(file);
-			} else {
-				ERROR("Cannot create file %s\n", certs[i].fn);
-			}
-		}
-	}
-
-	/* Save keys */
-	if (save_keys) {
-		for (i = 0 ; i < num_keys ; i++) {
-			if (!key_store(&keys[i])) {
-				ERROR("Cannot save %s\n", keys[i].desc);
 			}
 		}
 	}
@@ -610,5 +1056,5 @@ int main(int argc, char *argv[])
 
 	cert_cleanup();
 
-	return 0;
+	return ret;
 }
@@ -1,12 +1,18 @@
 /*
- * Copyright (c) 2015-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "debug.h"
 #include "key.h"
+#include "sha.h"
 #if USING_OPENSSL3
 #include <openssl/evp.h>
 #include <openssl/obj_mac.h>
@@ -16,6 +22,19 @@
 
 #define BUFFER_SIZE	256
 
+/* Digest of an image, computed once and looked up by file name */
+typedef struct sha_cache_s {
+	char *fn;
+	int md_alg;
+	int valid;
+	unsigned char md[SHA_MAX_DIGEST_LENGTH];
+} sha_cache_t;
+
+static sha_cache_t *sha_cache;
+static unsigned int sha_cache_num;
+static unsigned int sha_cache_next;
+static pthread_mutex_t sha_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
 #if USING_OPENSSL3
 static int get_algorithm_nid(int hash_alg)
 {
@@ -116,3 +135,156 @@ err:
 #endif
 }
 
+
+static sha_cache_t *sha_cache_lookup(int md_alg, const char *filename)
+{
+	unsigned int i;
+
+	for (i = 0; i < sha_cache_num; i++) {
+		if ((sha_cache[i].md_alg == md_alg) &&
+		    (strcmp(sha_cache[i].fn, filename) == 0)) {
+			return &sha_cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+/*
+ * Add an image to the cache, to be hashed by the next call to
+ * sha_cache_update(). Adding the same image twice has no effect.
+ */
+int sha_cache_add(int md_alg, const char *filename)
+{
+	sha_cache_t *entry;
+
+	if (sha_cache_lookup(md_alg, filename) != NULL) {
+		return 1;
+	}
+
+	entry = realloc(sha_cache, (sha_cache_num + 1) * sizeof(*sha_cache));
+	if (entry == NULL) {
+		ERROR("%s(): Failed to allocate memory\n", __func__);
+		return 0;
+	}
+	sha_cache = entry;
+
+	entry = &sha_cache[sha_cache_num];
+	memset(entry, 0, sizeof(*entry));
+	entry->fn = strdup(filename);
+	if (entry->fn == NULL) {
+		ERROR("%s(): Failed to allocate memory\n", __func__);
+		return 0;
+	}
+	entry->md_alg = md_alg;
+	sha_cache_num++;
+
+	return 1;
+}
+
+static void *sha_cache_worker(void *arg)
+{
+	int *ret = arg;
+	sha_cache_t *entry;
+
+	while (1) {
+		pthread_mutex_lock(&sha_cache_lock);
+		if (sha_cache_next == sha_cache_num) {
+			pthread_mutex_unlock(&sha_cache_lock);
+			break;
+		}
+		entry = &sha_cache[sha_cache_next++];
+		pthread_mutex_unlock(&sha_cache_lock);
+
+		if (entry->valid) {
+			continue;
+		}
+
+		if (!sha_file(entry->md_alg, entry->fn, entry->md)) {
+			*ret = 0;
+			continue;
+		}
+		entry->valid = 1;
+	}
+
+	return NULL;
+}
+
+/*
+ * Hash the images added to the cache which have not been hashed yet, using up
+ * to 'jobs' threads. Return 1 if all of them could be hashed.
+ */
+int sha_cache_update(unsigned int jobs)
+{
+	pthread_t *threads;
+	int *rets;
+	unsigned int i, num = 0;
+	int ret = 1;
+
+	if (jobs == 0U) {
+		jobs = 1U;
+	}
+
+	threads = calloc(jobs, sizeof(*threads));
+	rets = calloc(jobs, sizeof(*rets));
+	if ((threads == NULL) || (rets == NULL)) {
+		ERROR("%s(): Failed to allocate memory\n", __func__);
+		free(threads);
+		free(rets);
+		return 0;
+	}
+
+	sha_cache_next = 0U;
+
+	/* The calling thread is the first worker */
+	for (i = 0U; i < jobs; i++) {
+		rets[i] = 1;
+	}
+	for (i = 1U; i < jobs; i++) {
+		if (pthread_create(&threads[i], NULL, sha_cache_worker,
+				   &rets[i]) != 0) {
+			break;
+		}
+		num++;
+	}
+	sha_cache_worker(&rets[0]);
+	for (i = 1U; i <= num; i++) {
+		pthread_join(threads[i], NULL);
+	}
+
+	for (i = 0U; i < jobs; i++) {
+		ret &= rets[i];
+	}
+
+	free(threads);
+	free(rets);
+	return ret;
+}
+
+/*
+ * Same as sha_file(), but return the digest from the cache if the image has
+ * been hashed already.
+ */
+int sha_file_cached(int md_alg, const char *filename, unsigned char *md)
+{
+	sha_cache_t *entry = sha_cache_lookup(md_alg, filename);
+
+	if ((entry == NULL) || !entry->valid) {
+		return sha_file(md_alg, filename, md);
+	}
+
+	memcpy(md, entry->md, sizeof(entry->md));
+	return 1;
+}
+
+void sha_cache_cleanup(void)
+{
+	unsigned int i;
+
+	for (i = 0; i < sha_cache_num; i++) {
+		free(sha_cache[i].fn);
+	}
+	free(sha_cache);
+	sha_cache = NULL;
+	sha_cache_num = 0;
+}
@@ -26,6 +26,27 @@
 #define OPT_TOC_ENTRY 0
 #define OPT_PLAT_TOC_FLAGS 1
 #define OPT_ALIGN 2
+#define OPT_IN_PLACE 3
+
+/* Files are mapped rather than read into memory where that is available. */
+#ifndef _MSC_VER
+#define USE_MMAP 1
+#else
+#define USE_MMAP 0
+#endif
+
+/*
+ * A file mapped into memory. Images point into it instead of holding a copy
+ * of their contents, and it is unmapped when the last of them is freed.
+ */
+struct file_map {
+	void            *addr;
+	size_t           size;
+	dev_t            dev;
+	ino_t            ino;
+	unsigned int     refs;
+	struct file_map *next;
+};
 
 static int info_cmd(int argc, char *argv[]);
 static void info_usage(int);
@@ -55,6 +76,8 @@ static cmd_t cmds[] = {
 
 static image_desc_t *image_desc_head;
 static size_t nr_image_descs;
+static struct file_map *file_map_head;
+static uint64_t fip_end;
 static const uuid_t uuid_null;
 static int verbose;
 
@@ -138,6 +161,133 @@ static void xfwrite(void *buf, size_t size, FILE *fp, const char *filename)
 		log_errx("Failed to write %s", filename);
 }
 
+/* Monotonic time in microseconds, only used for the verbose timings. */
+static unsigned long long time_us(void)
+{
+#ifndef _MSC_VER
+	struct timespec ts;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+		return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+#endif
+	return 0;
+}
+
+/*
+ * Get the contents of the first 'size' bytes of an open file. The file is
+ * mapped read-only if possible, in which case the caller owns a reference
+ * to the mapping returned in *map_out. Otherwise, for instance for a pipe,
+ * the file is read into a buffer which the caller must free, and *map_out
+ * is set to NULL.
+ */
+static void *load_file(FILE *fp, const char *filename, size_t size,
+    struct file_map **map_out)
+{
+	void *buf;
+#if USE_MMAP
+	struct stat st;
+	struct file_map *map;
+
+	if (size != 0 && fstat(fileno(fp), &st) == 0) {
+		buf = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(fp), 0);
+		if (buf != MAP_FAILED) {
+			map = xzalloc(sizeof(*map),
+			    "failed to allocate memory for file mapping");
+			map->addr = buf;
+			map->size = size;
+			map->dev = st.st_dev;
+			map->ino = st.st_ino;
+			map->refs = 1;
+			map->next = file_map_head;
+			file_map_head = map;
+			*map_out = map;
+			return buf;
+		}
+	}
+#endif
+	*map_out = NULL;
+	buf = xmalloc(size, "failed to load file into memory");
+	if (fread(buf, 1, size, fp) != size)
+		log_errx("Failed to read %s", filename);
+	return buf;
+}
+
+static void put_file_map(struct file_map *map)
+{
+#if USE_MMAP
+	struct file_map **p;
+
+	assert(map->refs != 0);
+	if (--map->refs != 0)
+		return;
+
+	for (p = &file_map_head; *p != map; p = &(*p)->next)
+		assert(*p != NULL);
+	*p = map->next;
+
+	munmap(map->addr, map->size);
+	free(map);
+#endif
+}
+
+static void free_image(image_t *image)
+{
+	if (image->map != NULL)
+		put_file_map(image->map);
+	else
+		free(image->buffer);
+	free(image);
+}
+
+/* Return 1 if one of the images may point into the given file. */
+static int file_is_mapped(const char *filename)
+{
+#if USE_MMAP
+	struct stat st;
+	struct file_map *map;
+
+	if (stat(filename, &st) == -1)
+		return 0;
+
+	for (map = file_map_head; map != NULL; map = map->next)
+		if (map->dev == st.st_dev && map->ino == st.st_ino)
+			return 1;
+#endif
+	return 0;
+}
+
+/*
+ * Copy the images which point into the given file to memory, so that the
+ * file can be overwritten.
+ */
+static void unmap_images(const char *filename)
+{
+#if USE_MMAP
+	struct stat st;
+	image_desc_t *desc;
+
+	if (stat(filename, &st) == -1)
+		return;
+
+	for (desc = image_desc_head; desc != NULL; desc = desc->next) {
+		image_t *image = desc->image;
+		void *buf;
+
+		if (image == NULL || image->map == NULL ||
+		    image->map->dev != st.st_dev ||
+		    image->map->ino != st.st_ino)
+			continue;
+
+		buf = xmalloc(image->toc_e.size,
+		    "failed to allocate image buffer");
+		memcpy(buf, image->buffer, image->toc_e.size);
+		put_file_map(image->map);
+		image->map = NULL;
+		image->buffer = buf;
+	}
+#endif
+}
+
 static image_desc_t *new_image_desc(const uuid_t *uuid,
     const char *name, const char *cmdline_name)
 {
@@ -173,10 +323,8 @@ static void free_image_desc(image_desc_t *desc)
 	free(desc->name);
 	free(desc->cmdline_name);
 	free(desc->action_arg);
-	if (desc->image) {
-		free(desc->image->buffer);
-		free(desc->image);
-	}
+	if (desc->image)
+		free_image(desc->image);
 	free(desc);
 }
 
@@ -301,6 +449,7 @@ static int parse_fip(const char *filename, fip_toc_header_t *toc_header_out)
 	char *buf, *bufend;
 	fip_toc_header_t *toc_header;
 	fip_toc_entry_t *toc_entry;
+	struct file_map *map;
 	int terminated = 0;
 	size_t st_size;
 
@@ -319,9 +468,7 @@ static int parse_fip(const char *filename, fip_toc_header_t *toc_header_out)
 			log_err("ioctl %s", filename);
 #endif
 
-	buf = xmalloc(st_size, "failed to load file into memory");
-	if (fread(buf, 1, st_size, fp) != st_size)
-		log_errx("Failed to read %s", filename);
+	buf = load_file(fp, filename, st_size, &map);
 	bufend = buf + st_size;
 	fclose(fp);
 
@@ -345,6 +492,7 @@ static int parse_fip(const char *filename, fip_toc_header_t *toc_header_out)
 
 		/* Found the ToC terminator, we are done. */
 		if (memcmp(&toc_entry->uuid, &uuid_null, sizeof(uuid_t)) == 0) {
+			fip_end = toc_entry->offset_address;
 			terminated = 1;
 			break;
 		}
@@ -356,9 +504,7 @@ static int parse_fip(const char *filename, fip_toc_header_t *toc_header_out)
 		image = xzalloc(sizeof(*image),
 		    "failed to allocate memory for image");
 		image->toc_e = *toc_entry;
-		image->buffer = xmalloc(toc_entry->size,
-		    "failed to allocate image buffer, is FIP file corrupted?");
-		/* Overflow checks before memory copy. */
+		/* Overflow checks before memory access. */
 		if (toc_entry->size > (uint64_t)-1 - toc_entry->offset_address)
 			log_errx("FIP %s is corrupted: entry size exceeds 64 bit address space",
 				filename);
@@ -366,8 +512,17 @@ static int parse_fip(const char *filename, fip_toc_header_t *toc_header_out)
 			log_errx("FIP %s is corrupted: entry size exceeds FIP file size",
 				filename);
 
-		memcpy(image->buffer, buf + toc_entry->offset_address,
-		    toc_entry->size);
+		if (map != NULL) {
+			/* Point into the mapped FIP rather than copy. */
+			image->buffer = buf + toc_entry->offset_address;
+			image->map = map;
+			map->refs++;
+		} else {
+			image->buffer = xmalloc(toc_entry->size,
+			    "failed to allocate image buffer, is FIP file corrupted?");
+			memcpy(image->buffer, buf + toc_entry->offset_address,
+			    toc_entry->size);
+		}
 
 		/* If this is an unknown image, create a descriptor for it. */
 		desc = lookup_image_desc_from_uuid(&toc_entry->uuid);
@@ -393,7 +548,10 @@ static int parse_fip(const char *filename, fip_toc_header_t *toc_header_out)
 	if (terminated == 0)
 		log_errx("FIP %s does not have a ToC terminator entry",
 		    filename);
-	free(buf);
+	if (map != NULL)
+		put_file_map(map);
+	else
+		free(buf);
 	return 0;
 }
 
@@ -415,9 +573,7 @@ static image_t *read_image_from_file(const uuid_t *uuid, const char *filename)
 
 	image = xzalloc(sizeof(*image), "failed to allocate memory for image");
 	image->toc_e.uuid = *uuid;
-	image->buffer = xmalloc(st.st_size, "failed to allocate image buffer");
-	if (fread(image->buffer, 1, st.st_size, fp) != st.st_size)
-		log_errx("Failed to read %s", filename);
+	image->buffer = load_file(fp, filename, st.st_size, &image->map);
 	image->toc_e.size = st.st_size;
 
 	fclose(fp);
@@ -471,10 +627,93 @@ static void md_print(const unsigned char *md, size_t len)
 }
 #endif
 
+/*
+ * Omit this informative code portion for:
+ * Visual Studio missing SHA256.
+ * Statically linked builds.
+ */
+#if !defined(_MSC_VER) && !STATIC
+/* Images are hashed in parallel, each one by the first free thread. */
+struct hash_jobs {
+	image_t       **images;
+	unsigned char (*md)[SHA256_DIGEST_LENGTH];
+	size_t          nr_images;
+	size_t          next;
+	pthread_mutex_t lock;
+};
+
+static void *hash_worker(void *arg)
+{
+	struct hash_jobs *jobs = arg;
+	size_t i;
+
+	while (1) {
+		pthread_mutex_lock(&jobs->lock);
+		i = jobs->next++;
+		pthread_mutex_unlock(&jobs->lock);
+
+		if (i >= jobs->nr_images)
+			break;
+
+		SHA256(jobs->images[i]->buffer, jobs->images[i]->toc_e.size,
+		    jobs->md[i]);
+	}
+
+	return NULL;
+}
+
+static void hash_images(image_t **images,
+    unsigned char (*md)[SHA256_DIGEST_LENGTH], size_t nr_images)
+{
+	struct hash_jobs jobs = {
+		.images = images,
+		.md = md,
+		.nr_images = nr_images,
+	};
+	pthread_t *threads;
+	unsigned long long start = time_us();
+	unsigned long long bytes = 0;
+	long nr_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	size_t nr_threads, i;
+
+	nr_threads = (nr_cpus > 1) ? (size_t)nr_cpus : 1;
+	if (nr_threads > nr_images)
+		nr_threads = nr_images;
+
+	pthread_mutex_init(&jobs.lock, NULL);
+	threads = xzalloc(nr_threads * sizeof(*threads) + 1,
+	    "failed to allocate memory for hashing threads");
+
+	/* The calling thread is one of the workers. */
+	for (i = 1; i < nr_threads; i++)
+		if (pthread_create(&threads[i], NULL, hash_worker, &jobs) != 0)
+			break;
+	nr_threads = i;
+	hash_worker(&jobs);
+	for (i = 1; i < nr_threads; i++)
+		pthread_join(threads[i], NULL);
+
+	free(threads);
+	pthread_mutex_destroy(&jobs.lock);
+
+	if (verbose) {
+		for (i = 0; i < nr_images; i++)
+			bytes += images[i]->toc_e.size;
+		log_dbgx("Hashed %llu bytes in %llu us using %zu threads",
+		    bytes, time_us() - start, nr_threads);
+	}
+}
+#endif
+
 static int info_cmd(int argc, char *argv[])
 {
 	image_desc_t *desc;
 	fip_toc_header_t toc_header;
+#if !defined(_MSC_VER) && !STATIC
+	image_t **images = NULL;
+	unsigned char (*md)[SHA256_DIGEST_LENGTH] = NULL;
+	size_t nr_images = 0;
+#endif
 
 	if (argc != 2)
 		info_usage(EXIT_FAILURE);
@@ -491,6 +730,20 @@ static int info_cmd(int argc, char *argv[])
 		    (unsigned long long)toc_header.flags);
 	}
 
+#if !defined(_MSC_VER) && !STATIC
+	if (verbose) {
+		images = xzalloc(nr_image_descs * sizeof(*images) + 1,
+		    "failed to allocate memory for image list");
+		for (desc = image_desc_head; desc != NULL; desc = desc->next)
+			if (desc->image != NULL)
+				images[nr_images++] = desc->image;
+		md = xzalloc(nr_images * sizeof(*md) + 1,
+		    "failed to allocate memory for image hashes");
+		hash_images(images, md, nr_images);
+		nr_images = 0;
+	}
+#endif
+
 	for (desc = image_desc_head; desc != NULL; desc = desc->next) {
 		image_t *image = desc->image;
 
@@ -502,23 +755,19 @@ static int info_cmd(int argc, char *argv[])
 		       (unsigned long long)image->toc_e.size,
 		       desc->cmdline_name);
 
-		/*
-		 * Omit this informative code portion for:
-		 * Visual Studio missing SHA256.
-		 * Statically linked builds.
-		 */
 #if !defined(_MSC_VER) && !STATIC
 		if (verbose) {
-			unsigned char md[SHA256_DIGEST_LENGTH];
-
-			SHA256(image->buffer, image->toc_e.size, md);
 			printf(", sha256=");
-			md_print(md, sizeof(md));
+			md_print(md[nr_images++], SHA256_DIGEST_LENGTH);
 		}
 #endif
 		putchar('\n');
 	}
 
+#if !defined(_MSC_VER) && !STATIC
+	free(md);
+	free(images);
+#endif
 	return 0;
 }
 
@@ -537,6 +786,7 @@ static int pack_images(const char *filename, uint64_t toc_flags, unsigned long a
 	char *buf;
 	uint64_t entry_offset, buf_size, payload_size = 0, pad_size;
 	size_t nr_images = 0;
+	unsigned long long start = time_us();
 
 	for (desc = image_desc_head; desc != NULL; desc = desc->next)
 		if (desc->image != NULL)
@@ -577,6 +827,10 @@ static int pack_images(const char *filename, uint64_t toc_flags, unsigned long a
 	memset(toc_entry, 0, sizeof(*toc_entry));
 	toc_entry->offset_address = (entry_offset + align - 1) & ~(align - 1);
 
+	/* Opening the output truncates it, so first copy images out of it. */
+	if (file_is_mapped(filename))
+		unmap_images(filename);
+
 	/* Generate the FIP file. */
 	fp = fopen(filename, "wb");
 	if (fp == NULL)
@@ -609,7 +863,11 @@ static int pack_images(const char *filename, uint64_t toc_flags, unsigned long a
 		fputc(0x0, fp);
 
 	free(buf);
-	fclose(fp);
+	if (fclose(fp) != 0)
+		log_err("Failed to write %s", filename);
+
+	if (verbose)
+		log_dbgx("Wrote %s in %llu us", filename, time_us() - start);
 	return 0;
 }
 
@@ -639,7 +897,7 @@ static void update_fip(void)
 				    desc->cmdline_name,
 				    desc->action_arg);
 			}
-			free(desc->image);
+			free_image(desc->image);
 			desc->image = image;
 		} else {
 			if (verbose)
@@ -650,6 +908,138 @@ static void update_fip(void)
 	}
 }
 
+/* Return the end of the space in the FIP available to an image. */
+static uint64_t image_slot_end(const image_t *image)
+{
+	image_desc_t *desc;
+	uint64_t end = fip_end;
+
+	for (desc = image_desc_head; desc != NULL; desc = desc->next) {
+		const image_t *other = desc->image;
+
+		if (other == NULL || other == image)
+			continue;
+		if (other->toc_e.offset_address > image->toc_e.offset_address &&
+		    other->toc_e.offset_address < end)
+			end = other->toc_e.offset_address;
+	}
+
+	return end;
+}
+
+/*
+ * Replace images in the FIP that update_cmd() has just parsed without
+ * rewriting the whole file. This is only possible if every image to pack is
+ * already in the FIP, and the new image fits in the space of the old one,
+ * which is up to the next image. The offsets of all images are kept and the
+ * part of the old image which the new one does not cover is zeroed.
+ *
+ * Return 0 on success, or -1 if the FIP was left untouched because it has to
+ * be rewritten.
+ */
+static int update_fip_in_place(const char *filename, uint64_t toc_flags,
+    unsigned long align)
+{
+	image_desc_t *desc;
+	image_t *image;
+	fip_toc_header_t toc_header;
+	fip_toc_entry_t toc_entry;
+	unsigned long long start = time_us();
+	int ret = 0;
+	FILE *fp;
+
+	/* Check that all the new images fit before touching the FIP. */
+	for (desc = image_desc_head; desc != NULL; desc = desc->next) {
+		if (desc->action != DO_PACK)
+			continue;
+
+		if (desc->image == NULL) {
+			if (verbose)
+				log_dbgx("%s is not in %s, rewriting it",
+				    desc->cmdline_name, filename);
+			return -1;
+		}
+
+		image = read_image_from_file(&desc->uuid, desc->action_arg);
+		if (image->toc_e.size == 0ULL ||
+		    (desc->image->toc_e.offset_address & (align - 1)) != 0 ||
+		    desc->image->toc_e.offset_address + image->toc_e.size >
+		    image_slot_end(desc->image)) {
+			if (verbose)
+				log_dbgx("%s does not fit in place, rewriting %s",
+				    desc->action_arg, filename);
+			ret = -1;
+		}
+		free_image(image);
+		if (ret != 0)
+			return ret;
+	}
+
+	fp = fopen(filename, "r+b");
+	if (fp == NULL)
+		log_err("fopen %s", filename);
+
+	for (desc = image_desc_head; desc != NULL; desc = desc->next) {
+		uint64_t old_size;
+
+		if (desc->action != DO_PACK)
+			continue;
+
+		image = read_image_from_file(&desc->uuid, desc->action_arg);
+		old_size = desc->image->toc_e.size;
+		image->toc_e.offset_address = desc->image->toc_e.offset_address;
+		image->toc_e.flags = desc->image->toc_e.flags;
+		if (verbose)
+			log_dbgx("Replacing %s with %s in place",
+			    desc->cmdline_name, desc->action_arg);
+
+		if (fseek(fp, image->toc_e.offset_address, SEEK_SET))
+			log_errx("Failed to set file position");
+		xfwrite(image->buffer, image->toc_e.size, fp, filename);
+		for (; old_size > image->toc_e.size; old_size--)
+			fputc(0x0, fp);
+
+		free_image(desc->image);
+		desc->image = image;
+	}
+
+	/* Update the header and the sizes in the ToC, in its original order. */
+	if (fseek(fp, 0, SEEK_SET) ||
+	    fread(&toc_header, sizeof(toc_header), 1, fp) != 1)
+		log_errx("Failed to read %s", filename);
+	toc_header.flags = toc_flags;
+	if (fseek(fp, 0, SEEK_SET))
+		log_errx("Failed to set file position");
+	xfwrite(&toc_header, sizeof(toc_header), fp, filename);
+
+	while (1) {
+		long pos = ftell(fp);
+
+		if (fread(&toc_entry, sizeof(toc_entry), 1, fp) != 1)
+			log_errx("Failed to read %s", filename);
+		if (memcmp(&toc_entry.uuid, &uuid_null, sizeof(uuid_t)) == 0)
+			break;
+
+		desc = lookup_image_desc_from_uuid(&toc_entry.uuid);
+		if (desc == NULL || desc->action != DO_PACK)
+			continue;
+
+		toc_entry.size = desc->image->toc_e.size;
+		if (fseek(fp, pos, SEEK_SET))
+			log_errx("Failed to set file position");
+		xfwrite(&toc_entry, sizeof(toc_entry), fp, filename);
+		if (fseek(fp, 0, SEEK_CUR))
+			log_errx("Failed to set file position");
+	}
+
+	if (fclose(fp) != 0)
+		log_err("Failed to write %s", filename);
+
+	if (verbose)
+		log_dbgx("Updated %s in %llu us", filename, time_us() - start);
+	return 0;
+}
+
 static void parse_plat_toc_flags(const char *arg, unsigned long long *toc_flags)
 {
 	unsigned long long flags;
@@ -806,6 +1196,7 @@ static int update_cmd(int argc, char *argv[])
 	unsigned long long toc_flags = 0;
 	unsigned long align = 1;
 	int pflag = 0;
+	int in_place = 0;
 
 	if (argc < 2)
 		update_usage(EXIT_FAILURE);
@@ -813,6 +1204,7 @@ static int update_cmd(int argc, char *argv[])
 	opts = fill_common_opts(opts, &nr_opts, required_argument);
 	opts = add_opt(opts, &nr_opts, "align", required_argument, OPT_ALIGN);
 	opts = add_opt(opts, &nr_opts, "blob", required_argument, 'b');
+	opts = add_opt(opts, &nr_opts, "in-place", no_argument, OPT_IN_PLACE);
 	opts = add_opt(opts, &nr_opts, "out", required_argument, 'o');
 	opts = add_opt(opts, &nr_opts, "plat-toc-flags", required_argument,
 	    OPT_PLAT_TOC_FLAGS);
@@ -862,6 +1254,9 @@ static int update_cmd(int argc, char *argv[])
 		case OPT_ALIGN:
 			align = get_image_align(optarg);
 			break;
+		case OPT_IN_PLACE:
+			in_place = 1;
+			break;
 		case 'o':
 			snprintf(outfile, sizeof(outfile), "%s", optarg);
 			break;
@@ -881,11 +1276,17 @@ static int update_cmd(int argc, char *argv[])
 
 	if (access(argv[0], F_OK) == 0)
 		parse_fip(argv[0], &toc_header);
+	else
+		in_place = 0;
 
 	if (pflag)
 		toc_header.flags &= ~(0xffffULL << 32);
 	toc_flags = (toc_header.flags |= toc_flags);
 
+	if (in_place && strcmp(outfile, argv[0]) == 0 &&
+	    update_fip_in_place(outfile, toc_flags, align) == 0)
+		return 0;
+
 	update_fip();
 
 	pack_images(outfile, toc_flags, align);
@@ -901,6 +1302,7 @@ static void update_usage(int exit_status)
 	printf("Options:\n");
 	printf("  --align <value>\t\tEach image is aligned to <value> (default: 1).\n");
 	printf("  --blob uuid=...,file=...\tAdd or update an image with the given UUID pointed to by file.\n");
+	printf("  --in-place\t\t\tOverwrite the images in the FIP if they fit, rather than rewrite it.\n");
 	printf("  --out FIP_FILENAME\t\tSet an alternative output FIP file.\n");
 	printf("  --plat-toc-flags <value>\t16-bit platform specific flag field occupying bits 32-47 in 64-bit ToC header.\n");
 	printf("\n");
@@ -1151,7 +1553,7 @@ static int remove_cmd(int argc, char *argv[])
 			if (verbose)
 				log_dbgx("Removing %s",
 				    desc->cmdline_name);
-			free(desc->image);
+			free_image(desc->image);
 			desc->image = NULL;
 		} else {
 			log_warnx("%s does not exist in %s",